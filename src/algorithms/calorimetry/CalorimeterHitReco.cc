@@ -200,11 +200,11 @@ void CalorimeterHitReco::process(
         dd4hep::Position gpos;
         try {
             // global positions
-            gpos = m_converter->position(cellID);
+            gpos = m_cellid_geo.position(cellID);
 
             // masked position (look for a mother volume)
             if (gpos_mask != 0) {
-                auto mpos = m_converter->position(cellID & ~gpos_mask);
+                auto mpos = m_cellid_geo.position(cellID & ~gpos_mask);
                 // replace corresponding coords
                 for (const char &c : m_cfg.maskPos) {
                     switch (std::tolower(c)) {
@@ -247,7 +247,10 @@ void CalorimeterHitReco::process(
         std::vector<double> cdim;
         // get segmentation dimensions
 
-        const dd4hep::DDSegmentation::Segmentation* segmentation = m_converter->findReadout(local).segmentation()->segmentation;
+        const dd4hep::DDSegmentation::Segmentation* segmentation = m_cellid_geo.segmentation(cellID);
+        if (segmentation == nullptr) {
+            segmentation = m_converter->findReadout(local).segmentation()->segmentation;
+        }
         auto segmentation_type = segmentation->type();
 
         while (segmentation_type == "MultiSegmentation"){
@@ -259,7 +262,7 @@ void CalorimeterHitReco::process(
         }
 
         if (segmentation_type == "CartesianGridXY" || segmentation_type == "HexGridXY") {
-            auto cell_dim = m_converter->cellDimensions(cellID);
+            auto cell_dim = m_cellid_geo.cellDimensions(cellID);
             cdim.resize(3);
             cdim[0] = cell_dim[0];
             cdim[1] = cell_dim[1];
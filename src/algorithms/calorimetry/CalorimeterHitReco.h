@@ -25,6 +25,7 @@
 #include <string_view>
 
 #include "CalorimeterHitRecoConfig.h"
+#include "algorithms/interfaces/CellIDGeometrySvc.h"
 #include "algorithms/interfaces/WithPodConfig.h"
 
 namespace eicrecon {
@@ -76,6 +77,7 @@ namespace eicrecon {
   private:
     const dd4hep::Detector* m_detector{algorithms::GeoSvc::instance().detector()};
     const dd4hep::rec::CellIDPositionConverter* m_converter{algorithms::GeoSvc::instance().cellIDPositionConverter()};
+    const CellIDGeometrySvc& m_cellid_geo{CellIDGeometrySvc::instance()};
 
   };
 
@@ -0,0 +1,167 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2023 Friederike Bock, EICrecon Authors
+
+#include "CalorimeterMACluster.h"
+
+#include <DD4hep/Readout.h>
+#include <algorithms/service.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <gsl/pointers>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "services/evaluator/EvaluatorSvc.h"
+
+namespace eicrecon {
+
+namespace {
+
+  using CellIndex = std::array<int, 3>;
+
+  // Offsets to cells sharing a face, or an edge in two of the three indices,
+  // and the cell itself (hits with the same cell index are always merged)
+  constexpr auto kNeighbours = [] {
+    std::array<CellIndex, 19> offsets{};
+    std::size_t n = 0;
+    for (int dx = -1; dx <= 1; ++dx) {
+      for (int dy = -1; dy <= 1; ++dy) {
+        for (int dz = -1; dz <= 1; ++dz) {
+          if ((dx != 0) + (dy != 0) + (dz != 0) <= 2) {
+            offsets[n++] = {dx, dy, dz};
+          }
+        }
+      }
+    }
+    return offsets;
+  }();
+
+  // Pack a cell index into a single sortable key, 21 bits per index
+  std::uint64_t cell_key(int x, int y, int z) {
+    constexpr int offset = 1 << 20;
+    constexpr std::uint64_t mask = (1 << 21) - 1;
+    return ((static_cast<std::uint64_t>(x + offset) & mask) << 42)
+         | ((static_cast<std::uint64_t>(y + offset) & mask) << 21)
+         | (static_cast<std::uint64_t>(z + offset) & mask);
+  }
+
+} // namespace
+
+void CalorimeterMACluster::init() {
+
+    if (m_cfg.readout.empty()) {
+      error("'readout' is not provided, it is needed to know the fields in readout ids");
+      throw std::runtime_error("'readout' is not provided, it is needed to know the fields in readout ids");
+    }
+    m_idSpec = m_detector->readout(m_cfg.readout).idSpec();
+
+    std::function hit_to_map = [this](const edm4eic::CalorimeterHit &h) {
+      std::unordered_map<std::string, double> params;
+      for(const auto &p : m_idSpec.fields()) {
+        const std::string &name = p.first;
+        const dd4hep::IDDescriptor::Field* field = p.second;
+        params.emplace(name, field->value(h.getCellID()));
+      }
+      return params;
+    };
+
+    auto& serviceSvc = algorithms::ServiceSvc::instance();
+    const std::array<const std::string*, 3> expressions{&m_cfg.cellIndexX, &m_cfg.cellIndexY, &m_cfg.cellIndexZ};
+    for (std::size_t i = 0; i < expressions.size(); ++i) {
+      if (expressions[i]->empty()) {
+        m_cellIndex[i] = [](const edm4eic::CalorimeterHit&) { return 0.; };
+      } else {
+        m_cellIndex[i] = serviceSvc.service<EvaluatorSvc>("EvaluatorSvc")->compile(*expressions[i], hit_to_map);
+      }
+    }
+}
+
+void CalorimeterMACluster::process(
+      const CalorimeterMACluster::Input& input,
+      const CalorimeterMACluster::Output& output) const {
+
+    const auto [hits] = input;
+    auto [proto_clusters] = output;
+
+    const std::size_t n_hits = hits->size();
+
+    // Cell indices and energies of the hits that participate clustering,
+    // with a sorted (key, hit) table for neighbour lookups
+    std::vector<CellIndex> indices(n_hits);
+    std::vector<float> energies(n_hits);
+    std::vector<std::size_t> order;
+    std::vector<std::pair<std::uint64_t, std::size_t>> cells;
+    order.reserve(n_hits);
+    cells.reserve(n_hits);
+    for (std::size_t i = 0; i < n_hits; ++i) {
+      const auto hit = (*hits)[i];
+      energies[i] = hit.getEnergy();
+      if (energies[i] < m_cfg.minClusterHitEdep) {
+        continue;
+      }
+      for (std::size_t k = 0; k < 3; ++k) {
+        indices[i][k] = static_cast<int>(std::lround(m_cellIndex[k](hit)));
+      }
+      order.push_back(i);
+      cells.emplace_back(cell_key(indices[i][0], indices[i][1], indices[i][2]), i);
+    }
+    std::sort(cells.begin(), cells.end());
+    std::stable_sort(order.begin(), order.end(), [&energies](std::size_t a, std::size_t b) {
+      return energies[a] > energies[b];
+    });
+
+    std::vector<bool> used(n_hits, false);
+    std::vector<std::size_t> members;
+    members.reserve(order.size());
+
+    for (const std::size_t seed : order) {
+      if (used[seed]) {
+        continue;
+      }
+      // always start with the most energetic remaining hit
+      if (!(energies[seed] > m_cfg.minClusterSeedEdep)) {
+        break;
+      }
+
+      members.clear();
+      members.push_back(seed);
+      used[seed] = true;
+
+      // members grows while it is scanned, so this visits all aggregated hits
+      for (std::size_t m = 0; m < members.size(); ++m) {
+        const std::size_t current = members[m];
+        const auto& [x, y, z] = indices[current];
+        for (const auto& [dx, dy, dz] : kNeighbours) {
+          const std::uint64_t key = cell_key(x + dx, y + dy, z + dz);
+          for (auto it = std::lower_bound(cells.begin(), cells.end(), std::make_pair(key, std::size_t{0}));
+               it != cells.end() && it->first == key; ++it) {
+            const std::size_t other = it->second;
+            if (used[other]) {
+              continue;
+            }
+            // only aggregate hits with lower energy than the current hit
+            if (energies[other] >= energies[current] + m_cfg.aggregationMargin) {
+              continue;
+            }
+            used[other] = true;
+            members.push_back(other);
+          }
+        }
+      }
+
+      auto proto_cluster = proto_clusters->create();
+      for (const std::size_t idx : members) {
+        proto_cluster.addToHits((*hits)[idx]);
+        proto_cluster.addToWeights(1.);
+      }
+      trace("cluster seed E = {} with {} hits", energies[seed], members.size());
+    }
+
+    debug("Found {} MA clusters", proto_clusters->size());
+}
+
+} // namespace eicrecon
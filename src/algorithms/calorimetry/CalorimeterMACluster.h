@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2023 Friederike Bock, EICrecon Authors
+
+#pragma once
+
+#include <DD4hep/Detector.h>
+#include <DD4hep/IDDescriptor.h>
+#include <algorithms/algorithm.h>
+#include <algorithms/geo.h>
+#include <edm4eic/CalorimeterHitCollection.h>
+#include <edm4eic/ProtoClusterCollection.h>
+#include <functional>
+#include <string>
+#include <string_view>
+
+#include "CalorimeterMAClusterConfig.h"
+#include "algorithms/interfaces/WithPodConfig.h"
+
+namespace eicrecon {
+
+  using CalorimeterMAClusterAlgorithm = algorithms::Algorithm<
+    algorithms::Input<
+      edm4eic::CalorimeterHitCollection
+    >,
+    algorithms::Output<
+      edm4eic::ProtoClusterCollection
+    >
+  >;
+
+  /** MA clustering on a grid of integer cell indices.
+   *
+   * Starting from the most energetic hit above the seed threshold, hits that
+   * share a face or an edge (in at most two of the three indices) with a hit
+   * of the cluster are aggregated, as long as their energy does not exceed
+   * that of the aggregating hit by more than the aggregation margin. This is
+   * repeated with the most energetic remaining hit until it is below the seed
+   * threshold.
+   *
+   * \ingroup calorimetry
+   */
+  class CalorimeterMACluster
+  : public CalorimeterMAClusterAlgorithm,
+    public WithPodConfig<CalorimeterMAClusterConfig> {
+
+  public:
+    CalorimeterMACluster(std::string_view name)
+      : CalorimeterMAClusterAlgorithm{name,
+                            {"inputHitCollection"},
+                            {"outputProtoClusterCollection"},
+                            "MA clustering."} {}
+
+    void init() final;
+    void process(const Input&, const Output&) const final;
+
+  private:
+    const dd4hep::Detector* m_detector{algorithms::GeoSvc::instance().detector()};
+    dd4hep::IDDescriptor m_idSpec;
+
+    std::function<double(const edm4eic::CalorimeterHit&)> m_cellIndex[3];
+  };
+
+} // namespace eicrecon
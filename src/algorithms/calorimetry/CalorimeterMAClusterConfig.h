@@ -0,0 +1,30 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2023 Friederike Bock, EICrecon Authors
+
+#pragma once
+
+#include <Evaluator/DD4hepUnits.h>
+#include <string>
+
+namespace eicrecon {
+
+  struct CalorimeterMAClusterConfig {
+
+    std::string readout;
+
+    // integer cell indices, as expressions of the readout fields (empty means 0)
+    std::string cellIndexX;
+    std::string cellIndexY;
+    std::string cellIndexZ;
+
+    // minimum energy of the highest hit to start a new cluster
+    double minClusterSeedEdep = 100 * dd4hep::MeV;
+    // minimum hit energy to participate clustering
+    double minClusterHitEdep = 1 * dd4hep::MeV;
+    // a neighbour is only aggregated if its energy is below that of the
+    // aggregating hit plus this margin
+    double aggregationMargin = 1 * dd4hep::GeV;
+
+  };
+
+} // eicrecon
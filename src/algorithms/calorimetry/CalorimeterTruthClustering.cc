@@ -7,10 +7,13 @@
 #include <edm4hep/CaloHitContributionCollection.h>
 #include <edm4hep/MCParticleCollection.h>
 #include <podio/ObjectID.h>
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <gsl/pointers>
-#include <map>
+#include <optional>
+#include <utility>
+#include <vector>
 
 using namespace dd4hep;
 
@@ -25,8 +28,29 @@ namespace eicrecon {
     const auto [hits, mc] = input;
     auto [clusters] = output;
 
-    // Map mc track ID to protoCluster index
-    std::map<int32_t, int32_t> protoIndex;
+    // Sim hits sorted by cellID, built on first use for hits that cannot
+    // be matched by index (stable, so the first sim hit per cellID wins)
+    std::vector<std::pair<std::uint64_t, std::size_t>> mcIndexByCellID;
+    auto findByCellID = [&](std::uint64_t cellID) -> std::optional<std::size_t> {
+        if (mcIndexByCellID.empty() && !mc->empty()) {
+            mcIndexByCellID.reserve(mc->size());
+            for (std::size_t i = 0; i < mc->size(); ++i) {
+                mcIndexByCellID.emplace_back((*mc)[i].getCellID(), i);
+            }
+            std::sort(mcIndexByCellID.begin(), mcIndexByCellID.end());
+        }
+        auto it = std::lower_bound(mcIndexByCellID.begin(), mcIndexByCellID.end(),
+                                   std::make_pair(cellID, std::size_t{0}));
+        if (it == mcIndexByCellID.end() || it->first != cellID) {
+            return std::nullopt;
+        }
+        return it->second;
+    };
+
+    // Map mc track ID (MCParticle index) to protoCluster index, -1 if none yet
+    std::vector<int32_t> protoIndex;
+    protoIndex.reserve(hits->size());
+    int32_t untrackedProtoIndex = -1;
 
     // Loop over all calorimeter hits and sort per mcparticle
     for (const auto& hit : *hits) {
@@ -52,29 +76,30 @@ namespace eicrecon {
         if ((hit.getObjectID().index >= 0) && (hit.getObjectID().index < mc->size())) {
             mcIndex = hit.getObjectID().index;
         } else {
-            mcIndex = 0;
-            bool success = false;
-            for (auto tmpmc : *mc) {
-                if (tmpmc.getCellID() == hit.getCellID()) {
-                    success = true;
-                    break;
-                }
-                mcIndex++;
-            }
-            if (not success) {
+            const auto found = findByCellID(hit.getCellID());
+            if (!found) {
                 continue; // ignore hit if we couldn't match it to truth hit
             }
+            mcIndex = *found;
         }
 
-        const auto &trackID = (*mc)[mcIndex].getContributions(0).getParticle().getObjectID().index;
+        const auto trackID = (*mc)[mcIndex].getContributions(0).getParticle().getObjectID().index;
+        int32_t* proto = &untrackedProtoIndex;
+        if (trackID >= 0) {
+            if (static_cast<std::size_t>(trackID) >= protoIndex.size()) {
+                protoIndex.resize(trackID + 1, -1);
+            }
+            proto = &protoIndex[trackID];
+        }
         // Create a new protocluster if we don't have one for this trackID
-        if (protoIndex.count(trackID) == 0) {
+        if (*proto < 0) {
             clusters->create();
-            protoIndex[trackID] = clusters->size() - 1;
+            *proto = clusters->size() - 1;
         }
         // Add hit to the appropriate protocluster
-        (*clusters)[protoIndex[trackID]].addToHits(hit);
-        (*clusters)[protoIndex[trackID]].addToWeights(1);
+        auto cluster = (*clusters)[*proto];
+        cluster.addToHits(hit);
+        cluster.addToWeights(1);
     }
 
   }
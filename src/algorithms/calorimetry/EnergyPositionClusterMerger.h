@@ -3,7 +3,13 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <limits>
+#include <numeric>
+#include <optional>
+#include <vector>
 
 #include <algorithms/algorithm.h>
 #include <fmt/format.h>
@@ -72,44 +78,98 @@ namespace eicrecon {
 
         std::vector<bool> consumed(energy_clus->size(), false);
 
+        // precompute the matching variables of the energy clusters once
+        const std::size_t n_energy = energy_clus->size();
+        std::vector<double> energy_eta(n_energy), energy_phi(n_energy), energy_e(n_energy);
+        for (std::size_t ie = 0; ie < n_energy; ++ie) {
+            const auto& ec = (*energy_clus)[ie];
+            energy_eta[ie] = edm4hep::utils::eta(ec.getPosition());
+            energy_phi[ie] = edm4hep::utils::angleAzimuthal(ec.getPosition());
+            energy_e[ie]   = ec.getEnergy();
+        }
+
+        // eta-sorted index of the energy clusters; clusters with undefined eta always
+        // pass the eta check (NaN comparisons fail), so they are kept aside
+        std::vector<std::size_t> eta_order;
+        std::vector<double> eta_sorted;
+        std::vector<std::size_t> eta_undefined;
+        const bool use_eta_index = m_cfg.etaTolerance > 0;
+        if (use_eta_index) {
+            eta_order.reserve(n_energy);
+            for (std::size_t ie = 0; ie < n_energy; ++ie) {
+                (std::isnan(energy_eta[ie]) ? eta_undefined : eta_order).push_back(ie);
+            }
+            std::sort(eta_order.begin(), eta_order.end(),
+                      [&energy_eta](std::size_t a, std::size_t b) { return energy_eta[a] < energy_eta[b]; });
+            eta_sorted.reserve(eta_order.size());
+            for (std::size_t ie : eta_order) {
+                eta_sorted.push_back(energy_eta[ie]);
+            }
+        }
+
+        const double sin_half_phi_tolerance = sin(0.5 * m_cfg.phiTolerance);
+
+        // index of the first association of each cluster
+        const auto energy_assoc_index = buildAssociationIndex(*energy_clus, *energy_assoc);
+        const auto pos_assoc_index    = buildAssociationIndex(*pos_clus, *pos_assoc);
+
+        std::vector<std::size_t> candidates;
+        candidates.reserve(n_energy);
+
         // use position clusters as starting point
         for (const auto& pc : *pos_clus) {
 
             trace(" --> Processing position cluster {}, energy: {}", pc.getObjectID().index, pc.getEnergy());
 
+            const double pc_energy = pc.getEnergy();
+            const double pc_eta    = edm4hep::utils::eta(pc.getPosition());
+            const double pc_phi    = edm4hep::utils::angleAzimuthal(pc.getPosition());
+
+            // restrict the candidates to the eta tolerance window, slightly widened so
+            // that the exact tolerance check below decides at the boundary
+            candidates.clear();
+            if (use_eta_index && !std::isnan(pc_eta)) {
+                const double margin = m_cfg.etaTolerance * (1 + 1e-9) + 1e-12;
+                auto first = std::lower_bound(eta_sorted.begin(), eta_sorted.end(), pc_eta - margin);
+                auto last  = std::upper_bound(first, eta_sorted.end(), pc_eta + margin);
+                for (auto it = first; it != last; ++it) {
+                    candidates.push_back(eta_order[it - eta_sorted.begin()]);
+                }
+                candidates.insert(candidates.end(), eta_undefined.begin(), eta_undefined.end());
+            } else {
+                candidates.resize(n_energy);
+                std::iota(candidates.begin(), candidates.end(), 0);
+            }
+
             // check if we find a good match
             int best_match    = -1;
             double best_delta = std::numeric_limits<double>::max();
-            for (size_t ie = 0; ie < energy_clus->size(); ++ie) {
+            for (std::size_t ie : candidates) {
                 if (consumed[ie]) {
                     continue;
                 }
 
-                const auto& ec = (*energy_clus)[ie];
-
-                trace("  --> Evaluating energy cluster {}, energy: {}", ec.getObjectID().index, ec.getEnergy());
+                trace("  --> Evaluating energy cluster {}, energy: {}", ie, energy_e[ie]);
 
                 // 1. stop if not within tolerance
                 //    (make sure to handle rollover of phi properly)
-                const double de_rel = std::abs((pc.getEnergy() - ec.getEnergy()) / ec.getEnergy());
-                const double deta = std::abs(edm4hep::utils::eta(pc.getPosition())
-                                           - edm4hep::utils::eta(ec.getPosition()));
+                const double de_rel = std::abs((pc_energy - energy_e[ie]) / energy_e[ie]);
+                const double deta = std::abs(pc_eta - energy_eta[ie]);
                 // check the tolerance for sin(dphi/2) to avoid the hemisphere problem and allow
                 // for phi rollovers
-                const double dphi = edm4hep::utils::angleAzimuthal(pc.getPosition())
-                                  - edm4hep::utils::angleAzimuthal(ec.getPosition());
+                const double dphi = pc_phi - energy_phi[ie];
                 const double dsphi = std::abs(sin(0.5 * dphi));
                 if ((m_cfg.energyRelTolerance > 0 && de_rel > m_cfg.energyRelTolerance) ||
                     (m_cfg.etaTolerance > 0 && deta > m_cfg.etaTolerance) ||
-                    (m_cfg.phiTolerance > 0 && dsphi > sin(0.5 * m_cfg.phiTolerance))) {
+                    (m_cfg.phiTolerance > 0 && dsphi > sin_half_phi_tolerance)) {
                     continue;
                 }
                 // --> if we get here, we have a match within tolerance. Now treat the case
                 //     where we have multiple matches. In this case take the one with the closest
                 //     energies.
-                // 2. best match?
-                const double delta = fabs(pc.getEnergy() - ec.getEnergy());
-                if (delta < best_delta) {
+                // 2. best match? (on ties, the first in collection order as for a plain scan)
+                const double delta = fabs(pc_energy - energy_e[ie]);
+                if (delta < best_delta || (delta == best_delta && best_match >= 0 && static_cast<int>(ie) < best_match)) {
                     best_delta = delta;
                     best_match = ie;
                 }
@@ -134,22 +194,18 @@ namespace eicrecon {
                 trace("   --> Created a new combined cluster {}, energy: {}", new_clus.getObjectID().index, new_clus.getEnergy() );
 
                 // find association from energy cluster
-                auto ea = energy_assoc->begin();
-                for (; ea != energy_assoc->end(); ++ea) {
-                    if (ea->getRec() == ec) {
-                        break;
-                    }
+                std::optional<edm4eic::MCRecoClusterParticleAssociation> ea;
+                if (energy_assoc_index[best_match] >= 0) {
+                    ea = (*energy_assoc)[energy_assoc_index[best_match]];
                 }
                 // find association from position cluster if different
-                auto pa = pos_assoc->begin();
-                for (; pa != pos_assoc->end(); ++pa) {
-                    if (pa->getRec() == pc) {
-                        break;
-                    }
+                std::optional<edm4eic::MCRecoClusterParticleAssociation> pa;
+                if (pos_assoc_index[pc.getObjectID().index] >= 0) {
+                    pa = (*pos_assoc)[pos_assoc_index[pc.getObjectID().index]];
                 }
-                if (ea != energy_assoc->end() || pa != pos_assoc->end()) {
+                if (ea.has_value() || pa.has_value()) {
                     // we must write an association
-                    if (ea != energy_assoc->end() && pa != pos_assoc->end()) {
+                    if (ea.has_value() && pa.has_value()) {
                         // we have two associations
                         if (pa->getSimID() == ea->getSimID()) {
                             // both associations agree on the MCParticles entry
@@ -175,7 +231,7 @@ namespace eicrecon {
                             clusterassoc2.setRec(new_clus);
                             clusterassoc2.setSim(pa->getSim());
                         }
-                    } else if (ea != energy_assoc->end()) {
+                    } else if (ea.has_value()) {
                         // no position association
                         debug("   --> Only added energy cluster association to {}", ea->getSimID());
                         auto clusterassoc = merged_assoc->create();
@@ -184,7 +240,7 @@ namespace eicrecon {
                         clusterassoc.setWeight(1.0);
                         clusterassoc.setRec(new_clus);
                         clusterassoc.setSim(ea->getSim());
-                    } else if (pa != pos_assoc->end()) {
+                    } else if (pa.has_value()) {
                         // no energy association
                         debug("   --> Only added position cluster association to {}", pa->getSimID());
                         auto clusterassoc = merged_assoc->create();
@@ -216,6 +272,26 @@ namespace eicrecon {
 
         }
     }
+
+  private:
+
+    /** Index of the first association pointing to each cluster, -1 if none */
+    static std::vector<int> buildAssociationIndex(const edm4eic::ClusterCollection& clusters,
+                                                  const edm4eic::MCRecoClusterParticleAssociationCollection& assocs) {
+        std::vector<int> index(clusters.size(), -1);
+        for (std::size_t ia = 0; ia < assocs.size(); ++ia) {
+            const auto rec = assocs[ia].getRec();
+            if (!rec.isAvailable()) {
+                continue;
+            }
+            const auto ic = rec.getObjectID().index;
+            if (ic >= 0 && static_cast<std::size_t>(ic) < clusters.size()
+             && index[ic] < 0 && clusters[ic] == rec) {
+                index[ic] = ia;
+            }
+        }
+        return index;
+    }
   };
 
 } // namespace eicrecon
@@ -24,10 +24,22 @@
 #include <podio/ObjectID.h>
 #include <algorithm>
 #include <gsl/pointers>
-#include <iterator>
+#include <random>
 
 #include "algorithms/digi/PhotoMultiplierHitDigiConfig.h"
 
+namespace {
+
+    // SplitMix64 finalizer, to turn (seed, name, run, event) into well separated seeds
+    std::uint64_t mix64(std::uint64_t x) {
+        x += 0x9e3779b97f4a7c15ULL;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+        return x ^ (x >> 31);
+    }
+
+}
+
 namespace eicrecon {
 
 //------------------------
@@ -38,26 +50,12 @@ void PhotoMultiplierHitDigi::init()
     // print the configuration parameters
     debug() << m_cfg << endmsg;
 
-    /* warn if using potentially thread-unsafe seed
-     * FIXME: remove this warning when this issue is resolved:
-     *        https://github.com/eic/EICrecon/issues/539
-     */
-    if(m_cfg.seed==0) warning("using seed=0 may cause thread-unsafe behavior of TRandom (EICrecon issue 539)");
-
-    // random number generators
-    m_random.SetSeed(m_cfg.seed);
-    m_rngNorm = [&](){
-        return m_random.Gaus(0., 1.0);
-    };
-    m_rngUni = [&](){
-        return m_random.Uniform(0., 1.0);
-    };
-    //auto randSvc = svc<IRndmGenSvc>("RndmGenSvc", true);
-    auto sc1 = m_rngUni;//m_rngUni.initialize(randSvc, Rndm::Flat(0., 1.));
-    auto sc2 = m_rngNorm;//m_rngNorm.initialize(randSvc, Rndm::Gauss(0., 1.));
-    //if (!sc1.isSuccess() || !sc2.isSuccess()) {
-    if (!sc1 || !sc2) {
-        throw std::runtime_error("Cannot initialize random generator!");
+    // the random numbers of each event are drawn from their own stream, seeded
+    // by `EventSeed`; hash the algorithm name (FNV-1a) so that detectors
+    // sharing the same configured seed still get independent streams
+    m_name_hash = 0xcbf29ce484222325ULL;
+    for (const char c : name()) {
+        m_name_hash = (m_name_hash ^ static_cast<unsigned char>(c)) * 0x100000001b3ULL;
     }
 
     // initialize quantum efficiency table
@@ -72,10 +70,20 @@ void PhotoMultiplierHitDigi::process(
       const PhotoMultiplierHitDigi::Input& input,
       const PhotoMultiplierHitDigi::Output& output) const
 {
-        const auto [sim_hits] = input;
+        const auto [headers, sim_hits] = input;
         auto [raw_hits, hit_assocs] = output;
 
         trace("{:=^70}"," call PhotoMultiplierHitDigi::process ");
+
+        // per-event random number stream, independent of the order in which
+        // events are processed and of other threads
+        const std::uint64_t run_number   = headers->size() > 0 ? headers->at(0).getRunNumber() : 0;
+        const std::uint64_t event_number = headers->size() > 0 ? headers->at(0).getEventNumber() : 0;
+        RandomEngine rng(EventSeed(run_number, event_number));
+        std::uniform_real_distribution<double> uniform(0., 1.);
+        std::normal_distribution<double> normal(0., 1.);
+        auto rng_uniform = [&rng, &uniform] () { return uniform(rng); };
+
         std::unordered_map<CellIDType, std::vector<HitData>> hit_groups;
         // collect the photon hit in the same cell
         // calculate signal
@@ -87,10 +95,10 @@ void PhotoMultiplierHitDigi::process(
             trace("hit: pixel id={:#018X}  edep = {} eV", id, edep_eV);
 
             // overall safety factor
-            if (m_rngUni() > m_cfg.safetyFactor) continue;
+            if (rng_uniform() > m_cfg.safetyFactor) continue;
 
             // quantum efficiency
-            if (!qe_pass(edep_eV, m_rngUni())) continue;
+            if (!qe_pass(edep_eV, rng_uniform())) continue;
 
             // pixel gap cuts
             if(m_cfg.enablePixelGaps) {
@@ -103,7 +111,7 @@ void PhotoMultiplierHitDigi::process(
             trace(" -> hit accepted");
             trace(" -> MC hit id={}", sim_hit.getObjectID().index);
             auto   time = sim_hit.getTime();
-            double amp  = m_cfg.speMean + m_rngNorm() * m_cfg.speError;
+            double amp  = m_cfg.speMean + normal(rng) * m_cfg.speError;
 
             // insert hit to `hit_groups`
             InsertHit(
@@ -111,7 +119,8 @@ void PhotoMultiplierHitDigi::process(
                 id,
                 amp,
                 time,
-                sim_hit_index
+                sim_hit_index,
+                rng
                 );
         }
 
@@ -130,11 +139,11 @@ void PhotoMultiplierHitDigi::process(
         if (m_cfg.enableNoise) {
           trace("{:=^70}"," BEGIN NOISE INJECTION ");
           float p = m_cfg.noiseRate*m_cfg.noiseTimeWindow;
-          auto cellID_action = [this,&hit_groups] (auto id) {
+          auto cellID_action = [this,&hit_groups,&rng,&normal,&rng_uniform] (auto id) {
 
             // cell time, signal amplitude
-            double   amp  = m_cfg.speMean + m_rngNorm()*m_cfg.speError;
-            TimeType time = m_cfg.noiseTimeWindow*m_rngUni() / dd4hep::ns;
+            double   amp  = m_cfg.speMean + normal(rng)*m_cfg.speError;
+            TimeType time = m_cfg.noiseTimeWindow*rng_uniform() / dd4hep::ns;
             dd4hep::Position pos_hit_global = m_converter->position(id);
 
             // insert in `hit_groups`, or if the pixel already has a hit, update `npe` and `signal`
@@ -144,11 +153,12 @@ void PhotoMultiplierHitDigi::process(
                 amp,
                 time,
                 0, // not used
+                rng,
                 true
                 );
 
           };
-          m_VisitRngCellIDs(cellID_action, p);
+          m_VisitRngCellIDs(cellID_action, p, rng_uniform);
         }
 
         // build output `RawTrackerHit` and `MCRecoTrackerHitAssociation` collections
@@ -184,6 +194,11 @@ void PhotoMultiplierHitDigi::process(
         }
 }
 
+std::uint64_t PhotoMultiplierHitDigi::EventSeed(std::uint64_t run_number, std::uint64_t event_number) const
+{
+        return mix64(mix64(mix64(m_cfg.seed ^ m_name_hash) ^ run_number) ^ event_number);
+}
+
 void PhotoMultiplierHitDigi::qe_init()
 {
         // get quantum efficiency table
@@ -216,55 +231,41 @@ void PhotoMultiplierHitDigi::qe_init()
         if (qeff.back().first < 3.0) {
             warning("Quantum efficiency data end at {:.2f} {}", qeff.back().first, " eV, maybe you are using wrong units?");
         }
-}
-
 
-template<class RndmIter, typename T, class Compare> RndmIter PhotoMultiplierHitDigi::interval_search(RndmIter beg, RndmIter end, const T &val, Compare comp) const
-{
-        // special cases
-        auto dist = std::distance(beg, end);
-        if ((dist < 2) || (comp(*beg, val) > 0) || (comp(*std::prev(end), val) < 0)) {
-            return end;
+        // tabulate the linearly interpolated QE at the centers of uniform energy
+        // bins, so that `qe_pass` is a single table lookup per photon
+        m_qe_lut.clear();
+        m_qe_lut_min       = qeff.front().first;
+        m_qe_lut_inv_width = 0.;
+        const double range = qeff.back().first - qeff.front().first;
+        if (qeff.size() < 2 || range <= 0.) {
+            warning("Quantum efficiency data cover no energy range, no photons will be accepted");
+            return;
         }
-        auto mid = std::next(beg, dist / 2);
-
-        while (mid != end) {
-            if (comp(*mid, val) == 0) {
-                return mid;
-            } else if (comp(*mid, val) > 0) {
-                end = mid;
-            } else {
-                beg = std::next(mid);
+        m_qe_lut.resize(m_qe_lut_bins);
+        m_qe_lut_inv_width = m_qe_lut_bins / range;
+        std::size_t k = 0;
+        for (std::size_t i = 0; i < m_qe_lut_bins; ++i) {
+            const double ev = m_qe_lut_min + (i + 0.5) / m_qe_lut_inv_width;
+            while (k + 2 < qeff.size() && qeff[k + 1].first < ev) {
+                ++k;
             }
-            mid = std::next(beg, std::distance(beg, end)/2);
-        }
-
-        if (mid == end || comp(*mid, val) > 0) {
-            return std::prev(mid);
+            const auto& [e1, qe1] = qeff[k];
+            const auto& [e2, qe2] = qeff[k + 1];
+            m_qe_lut[i] = (e2 - e1 != 0) ? (qe1 * (e2 - ev) + qe2 * (ev - e1)) / (e2 - e1) : qe1;
         }
-        return mid;
 }
 
+
 bool PhotoMultiplierHitDigi::qe_pass(double ev, double rand) const
 {
-        auto it = interval_search(qeff.begin(), qeff.end(), ev,
-                    [] (const std::pair<double, double> &vals, double val) {
-                        return vals.first - val;
-                    });
-
-        if (it == qeff.end()) {
-            // warning("{} eV is out of QE data range, assuming 0\% efficiency",ev);
+        // bin in the uniform table; negative, NaN and out-of-range energies
+        // are outside the QE data, assume 0% efficiency
+        const double x = (ev - m_qe_lut_min) * m_qe_lut_inv_width;
+        if (!(x >= 0.) || x >= m_qe_lut.size()) {
             return false;
         }
-
-        double prob = it->second;
-        auto itn = std::next(it);
-        if (itn != qeff.end() && (itn->first - it->first != 0)) {
-            prob = (it->second*(itn->first - ev) + itn->second*(ev - it->first)) / (itn->first - it->first);
-        }
-
-        // trace("{} eV, QE: {}\%",ev,prob*100.);
-        return rand <= prob;
+        return rand <= m_qe_lut[static_cast<std::size_t>(x)];
 }
 
 
@@ -276,6 +277,7 @@ void PhotoMultiplierHitDigi::InsertHit(
     double           amp,
     TimeType         time,
     std::size_t      sim_hit_index,
+    RandomEngine&    rng,
     bool             is_noise_hit
     ) const // NOLINTEND(bugprone-easily-swappable-parameters)
 {
@@ -294,7 +296,7 @@ void PhotoMultiplierHitDigi::InsertHit(
     }
     // no hits group found
     if (i >= it->second.size()) {
-      auto sig = amp + m_cfg.pedMean + m_cfg.pedError * m_rngNorm();
+      auto sig = amp + m_cfg.pedMean + m_cfg.pedError * std::normal_distribution<double>(0., 1.)(rng);
       decltype(HitData::sim_hit_indices) indices;
       if(!is_noise_hit) indices.push_back(sim_hit_index);
       hit_groups.insert({ id, {HitData{1, sig, time, indices}} });
@@ -302,7 +304,7 @@ void PhotoMultiplierHitDigi::InsertHit(
       trace("    so new group @ {:#018X}: signal={}", id, sig);
     }
   } else {
-    auto sig = amp + m_cfg.pedMean + m_cfg.pedError * m_rngNorm();
+    auto sig = amp + m_cfg.pedMean + m_cfg.pedError * std::normal_distribution<double>(0., 1.)(rng);
     decltype(HitData::sim_hit_indices) indices;
     if(!is_noise_hit) indices.push_back(sim_hit_index);
     hit_groups.insert({ id, {HitData{1, sig, time, indices}} });
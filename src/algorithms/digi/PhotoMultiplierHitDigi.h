@@ -20,16 +20,18 @@
 #include <DDRec/CellIDPositionConverter.h>
 #include <Math/GenVector/Cartesian3D.h>
 #include <Math/GenVector/DisplacementVector3D.h>
-#include <TRandomGen.h>
 #include <algorithms/algorithm.h>
 #include <algorithms/geo.h>
 #include <edm4eic/MCRecoTrackerHitAssociationCollection.h>
 #include <edm4eic/RawTrackerHitCollection.h>
+#include <edm4hep/EventHeaderCollection.h>
 #include <edm4hep/SimTrackerHitCollection.h>
 #include <stdint.h>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <gsl/pointers>
+#include <random>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -44,6 +46,7 @@ namespace eicrecon {
 
   using PhotoMultiplierHitDigiAlgorithm = algorithms::Algorithm<
     algorithms::Input<
+      edm4hep::EventHeaderCollection,
       edm4hep::SimTrackerHitCollection
     >,
     algorithms::Output<
@@ -59,7 +62,7 @@ namespace eicrecon {
   public:
     PhotoMultiplierHitDigi(std::string_view name)
       : PhotoMultiplierHitDigiAlgorithm{name,
-                            {"inputHitCollection"},
+                            {"eventHeaderCollection", "inputHitCollection"},
                             {"outputRawHitCollection", "outputRawHitAssociations"},
                             "Digitize within ADC range, add pedestal, convert time "
                             "with smearing resolution."} {}
@@ -79,17 +82,19 @@ namespace eicrecon {
       std::vector<std::size_t> sim_hit_indices;
     };
 
-    // random number generators
-    TRandomMixMax m_random;
-    std::function<double()> m_rngNorm;
-    std::function<double()> m_rngUni;
-    //Rndm::Numbers m_rngUni, m_rngNorm;
+    // random number engine; a new one is seeded for every event in `process`,
+    // from the run number, event number, configured seed and algorithm name
+    using RandomEngine = std::mt19937_64;
+
+    // seed of the random number stream for a given run and event
+    std::uint64_t EventSeed(std::uint64_t run_number, std::uint64_t event_number) const;
 
     // set `m_VisitAllRngPixels`, a visitor to run an action (type
-    // `function<void(cellID)>`) on a selection of random CellIDs; must be
+    // `function<void(cellID)>`) on a selection of random CellIDs, drawing
+    // uniform random numbers in [0,1) from the provided generator; must be
     // defined externally, since this would be detector-specific
     void SetVisitRngCellIDs(
-        std::function< void(std::function<void(CellIDType)>, float) > visitor
+        std::function< void(std::function<void(CellIDType)>, float, std::function<double()>) > visitor
         )
     { m_VisitRngCellIDs = visitor; }
 
@@ -104,8 +109,8 @@ namespace eicrecon {
 protected:
 
     // visitor of all possible CellIDs (set with SetVisitRngCellIDs)
-    std::function< void(std::function<void(CellIDType)>, float) > m_VisitRngCellIDs =
-      [] ( std::function<void(CellIDType)> visitor_action, float p ) { /* default no-op */ };
+    std::function< void(std::function<void(CellIDType)>, float, std::function<double()>) > m_VisitRngCellIDs =
+      [] ( std::function<void(CellIDType)> visitor_action, float p, std::function<double()> rng_uniform ) { /* default no-op */ };
 
     // pixel gap mask
     std::function< bool(CellIDType, dd4hep::Position) > m_PixelGapMask =
@@ -123,18 +128,24 @@ private:
         double           amp,
         TimeType         time,
         std::size_t      sim_hit_index,
+        RandomEngine&    rng,
         bool             is_noise_hit = false
         ) const;
 
     const dd4hep::Detector* m_detector{algorithms::GeoSvc::instance().detector()};
     const dd4hep::rec::CellIDPositionConverter* m_converter{algorithms::GeoSvc::instance().cellIDPositionConverter()};
 
-    // std::default_random_engine generator; // TODO: need something more appropriate here
-    // std::normal_distribution<double> m_normDist; // defaults to mean=0, sigma=1
+    // hash of the algorithm name, to decorrelate the streams of different detectors
+    std::uint64_t m_name_hash = 0;
 
     std::vector<std::pair<double, double>> qeff;
     void qe_init();
-    template<class RndmIter, typename T, class Compare> RndmIter interval_search(RndmIter beg, RndmIter end, const T &val, Compare comp) const;
     bool qe_pass(double ev, double rand) const;
+
+    // quantum efficiency tabulated in uniform energy bins, built by `qe_init`
+    static constexpr std::size_t m_qe_lut_bins = 4096;
+    std::vector<double> m_qe_lut;
+    double m_qe_lut_min       = 0.; // [eV]
+    double m_qe_lut_inv_width = 0.; // [1/eV]
 };
 }
@@ -10,11 +10,9 @@ namespace eicrecon {
     public:
 
       // random number generator seed
-      /* FIXME: don't use 0 if `TRandomMixMax` is the RNG, it can get "stuck"
-       * FIXME: remove this warning when this issue is resolved:
-       *        https://github.com/eic/EICrecon/issues/539
-       */
-      unsigned long seed = 1; // seed for RNG (note: `0` might mean "unique" seed)
+      // - each event draws from its own stream, seeded from this value, the
+      //   run and event numbers, and the algorithm name
+      unsigned long seed = 1;
 
       // triggering
       double hitTimeWindow  = 20.0;   // time gate in which 2 input hits will be grouped to 1 output hit // [ns]
@@ -74,7 +72,7 @@ namespace eicrecon {
 
   };
 
-  std::ostream& operator<<(std::ostream& os, const PhotoMultiplierHitDigiConfig& cfg) {
+  inline std::ostream& operator<<(std::ostream& os, const PhotoMultiplierHitDigiConfig& cfg) {
     os << fmt::format("{:=^60}", " PhotoMultiplierHitDigiConfig Settings ") << std::endl;
     auto print_param = [&os] (auto name, auto val) {
       os << fmt::format("  {:>20} = {:<}", name, val) << std::endl;
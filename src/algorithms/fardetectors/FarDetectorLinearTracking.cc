@@ -12,12 +12,12 @@
 #include <edm4hep/utils/vector_utils.h>
 #include <fmt/core.h>
 #include <stdint.h>
+#include <Eigen/Eigenvalues>
 #include <Eigen/Geometry>
-#include <Eigen/Householder>
-#include <Eigen/Jacobi>
-#include <Eigen/QR>
-#include <Eigen/SVD>
+#include <algorithm>
 #include <cmath>
+#include <limits>
+#include <numeric>
 #include <utility>
 
 #include "FarDetectorLinearTracking.h"
@@ -35,6 +35,9 @@ namespace eicrecon {
       m_optimumDirection = Eigen::AngleAxisd(m_cfg.optimum_theta,Eigen::Vector3d::UnitY())*m_optimumDirection;
       m_optimumDirection = Eigen::AngleAxisd(m_cfg.optimum_phi,Eigen::Vector3d::UnitZ())*m_optimumDirection;
 
+      // Transverse axis along which hits are indexed for the road search
+      m_roadAxis = m_optimumDirection.unitOrthogonal();
+
     }
 
     void FarDetectorLinearTracking::process(
@@ -51,75 +54,158 @@ namespace eicrecon {
           return;
         }
 
-        // Check there aren't too many hits in any layer to handle
-        // Temporary limit of number of hits per layer before Kalman filtering/GNN implemented
-        // TODO - Implement more sensible solution
+        // Without the direction restriction every hit combination has to be fitted,
+        // the road search only visits nearby hits and can take more per layer
+        std::size_t layerHitsMax = m_cfg.restrict_direction ? m_cfg.road_layer_hits_max : m_cfg.layer_hits_max;
         for(const auto& layerHits: inputhits){
-          if((*layerHits).size()>m_cfg.layer_hits_max){
+          if((*layerHits).size()>layerHitsMax){
             info("Too many hits in layer");
             return;
           }
         }
 
-        // Create a matrix to store the hit positions
-        Eigen::MatrixXd hitMatrix(3,m_cfg.n_layer);
-        // Loop over all combinations of hits fitting a track to all layers
-        buildMatrixRecursive(m_cfg.n_layer-1,&hitMatrix,inputhits,outputTracks);
+        std::vector<LayerHits> layers(m_cfg.n_layer);
+        fillLayerHits(inputhits,layers);
+
+        // Scratch space for the candidate hits of each layer
+        std::vector<std::vector<std::size_t>> candidates(m_cfg.n_layer);
+
+        // Loop over all combinations of hits fitting a track to all layers,
+        // using a fixed size hit matrix for the common 4 layer case
+        if(m_cfg.n_layer==4){
+          Eigen::Matrix<double,3,4> hitMatrix;
+          buildMatrixRecursive<4>(m_cfg.n_layer-1,hitMatrix,layers,candidates,outputTracks);
+        }
+        else{
+          Eigen::Matrix<double,3,Eigen::Dynamic> hitMatrix(3,m_cfg.n_layer);
+          buildMatrixRecursive<Eigen::Dynamic>(m_cfg.n_layer-1,hitMatrix,layers,candidates,outputTracks);
+        }
+
+    }
+
+
+    void FarDetectorLinearTracking::fillLayerHits(const std::vector<gsl::not_null<const edm4hep::TrackerHitCollection*>>& hits,
+                                                  std::vector<LayerHits>& layers) const {
+
+      std::vector<double> minLongitudinal(m_cfg.n_layer, std::numeric_limits<double>::max());
+      std::vector<double> maxLongitudinal(m_cfg.n_layer, std::numeric_limits<double>::lowest());
+
+      for(int level=0; level<m_cfg.n_layer; level++){
+        auto& layer = layers[level];
+        const auto& layerHits = *hits[level];
+
+        layer.positions.reserve(layerHits.size());
+        for(const auto& hit : layerHits){
+          auto pos = hit.getPosition();
+          layer.positions.emplace_back(pos.x, pos.y, pos.z);
+          double longitudinal    = layer.positions.back().dot(m_optimumDirection);
+          minLongitudinal[level] = std::min(minLongitudinal[level], longitudinal);
+          maxLongitudinal[level] = std::max(maxLongitudinal[level], longitudinal);
+        }
+
+        layer.roadOrder.resize(layer.positions.size());
+        std::iota(layer.roadOrder.begin(), layer.roadOrder.end(), 0);
+        std::sort(layer.roadOrder.begin(), layer.roadOrder.end(), [&](std::size_t a, std::size_t b) {
+          return m_roadAxis.dot(layer.positions[a]) < m_roadAxis.dot(layer.positions[b]);
+        });
+        layer.roadCoordinate.reserve(layer.positions.size());
+        for(std::size_t index : layer.roadOrder){
+          layer.roadCoordinate.push_back(m_roadAxis.dot(layer.positions[index]));
+        }
+      }
+
+      // A hit pair passing checkHitPair has a transverse offset of at most
+      // (longitudinal step) * tan(step_angle_tolerance), which bounds the
+      // window searched around the hit already chosen in the next layer
+      for(int level=0; level<m_cfg.n_layer; level++){
+        auto& layer = layers[level];
+        if(level==m_cfg.n_layer-1 || m_cfg.step_angle_tolerance>=M_PI_2 || layers[level+1].positions.empty()){
+          layer.roadHalfWidth = std::numeric_limits<double>::infinity();
+          continue;
+        }
+        double maxStep = std::max(maxLongitudinal[level+1]-minLongitudinal[level], 0.0);
+        layer.roadHalfWidth = maxStep*std::tan(m_cfg.step_angle_tolerance)*(1+1e-9) + 1e-9;
+      }
 
     }
 
 
+    template <int N>
     void FarDetectorLinearTracking::buildMatrixRecursive(int level,
-                                                        Eigen::MatrixXd* hitMatrix,
-                                                        const std::vector<gsl::not_null<const edm4hep::TrackerHitCollection*>>& hits,
+                                                        Eigen::Matrix<double,3,N>& hitMatrix,
+                                                        const std::vector<LayerHits>& layers,
+                                                        std::vector<std::vector<std::size_t>>& candidates,
                                                         gsl::not_null<edm4eic::TrackSegmentCollection*> outputTracks ) const {
 
+      const auto& layer = layers[level];
+      auto& layerCandidates = candidates[level];
+      layerCandidates.clear();
+
+      bool checkPair = m_cfg.restrict_direction && level<m_cfg.n_layer-1;
+
+      if(checkPair){
+        // Only hits inside the road around the hit chosen in the next layer can pass the direction check
+        double centre = m_roadAxis.dot(hitMatrix.col(level+1));
+        auto first = std::lower_bound(layer.roadCoordinate.begin(), layer.roadCoordinate.end(), centre-layer.roadHalfWidth);
+        auto last  = std::upper_bound(first, layer.roadCoordinate.end(), centre+layer.roadHalfWidth);
+        for(auto it=first; it!=last; ++it){
+          layerCandidates.push_back(layer.roadOrder[it-layer.roadCoordinate.begin()]);
+        }
+        // Keep the collection order so the output does not depend on the index
+        std::sort(layerCandidates.begin(), layerCandidates.end());
+      }
+      else{
+        layerCandidates.resize(layer.positions.size());
+        std::iota(layerCandidates.begin(), layerCandidates.end(), 0);
+      }
+
       // Iterate over hits in this layer
-      for(auto hit : (*hits[level])){
-        auto pos = hit.getPosition();
-        hitMatrix->col(level) << pos.x, pos.y, pos.z;
+      for(std::size_t index : layerCandidates){
+        hitMatrix.col(level) = layer.positions[index];
 
         // Check the last two hits are within a certain angle of the optimum direction
-        if(m_cfg.restrict_direction && level<m_cfg.n_layer-1){
-          if(!checkHitPair(hitMatrix->col(level),hitMatrix->col(level+1))){
+        if(checkPair){
+          if(!checkHitPair(hitMatrix.col(level),hitMatrix.col(level+1))){
             continue;
           }
         }
 
         if(level>0){
-          buildMatrixRecursive(level-1,
-                               hitMatrix,
-                               hits,
-                               outputTracks);
+          buildMatrixRecursive<N>(level-1,
+                                  hitMatrix,
+                                  layers,
+                                  candidates,
+                                  outputTracks);
         }
         else{
-          checkHitCombination(hitMatrix,outputTracks);
+          checkHitCombination<N>(hitMatrix,outputTracks);
         }
       }
 
     }
 
 
-    void FarDetectorLinearTracking::checkHitCombination(Eigen::MatrixXd* hitMatrix,
+    template <int N>
+    void FarDetectorLinearTracking::checkHitCombination(const Eigen::Matrix<double,3,N>& hitMatrix,
                                                         gsl::not_null<edm4eic::TrackSegmentCollection*> outputTracks ) const {
 
-      Eigen::Vector3d weightedAnchor = (*hitMatrix)*m_layerWeights/(m_layerWeights.sum());
-
-      auto localMatrix = (*hitMatrix).colwise()-weightedAnchor;
+      Eigen::Vector3d weightedAnchor = hitMatrix*m_layerWeights/(m_layerWeights.sum());
 
-      Eigen::BDCSVD<Eigen::MatrixXd> svd(localMatrix.transpose(), Eigen::ComputeThinU | Eigen::ComputeThinV);
+      Eigen::Matrix<double,3,N> localMatrix = hitMatrix.colwise()-weightedAnchor;
 
-      auto V = svd.matrixV();
+      // Principal components of the 3x3 scatter matrix: the largest eigenvalue gives the
+      // line direction, the two smaller ones the summed squared residuals from the line
+      Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver(localMatrix*localMatrix.transpose());
 
-      // Rotate into principle components and calculate chi2/ndf
-      auto rotatedMatrix = localMatrix.transpose()*V;
-      auto residuals     = rotatedMatrix.rightCols(2);
-      double chi2        = (residuals.array()*residuals.array()).sum()/(2*m_cfg.n_layer);
+      const auto& eigenvalues = solver.eigenvalues();
+      double chi2 = (std::max(eigenvalues(0),0.0)+std::max(eigenvalues(1),0.0))/(2*m_cfg.n_layer);
 
       if(chi2>m_cfg.chi2_max) return;
 
+      Eigen::Vector3d direction = solver.eigenvectors().col(2);
+
       edm4hep::Vector3d outPos = weightedAnchor.data();
-      edm4hep::Vector3d outVec = V.col(0).data();
+      edm4hep::Vector3d outVec = direction.data();
 
       // Make sure fit was pointing in the right direction
       if(outVec.z>0) outVec = outVec*-1;
@@ -158,9 +244,8 @@ namespace eicrecon {
 
       double angle = std::acos(hitDiff.dot(m_optimumDirection));
 
-      debug("Vector: x={}, y={}, z={}",hitDiff.x(),hitDiff.y(),hitDiff.z());
-      debug("Optimum: x={}, y={}, z={}",m_optimumDirection.x(),m_optimumDirection.y(),m_optimumDirection.z());
-      debug("Angle: {}, Tolerance {}",angle,m_cfg.step_angle_tolerance);
+      trace("Vector: x={}, y={}, z={}",hitDiff.x(),hitDiff.y(),hitDiff.z());
+      trace("Angle: {}, Tolerance {}",angle,m_cfg.step_angle_tolerance);
 
       if(angle>m_cfg.step_angle_tolerance) return false;
 
@@ -9,6 +9,7 @@
 #include <edm4eic/TrackSegmentCollection.h>
 #include <edm4hep/TrackerHitCollection.h>
 #include <gsl/pointers>
+#include <cstddef>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -38,16 +39,30 @@ public:
   void process(const Input&, const Output&) const final;
 
 private:
+  /** Hits of one layer, with an index sorted along the transverse road axis **/
+  struct LayerHits {
+    std::vector<Eigen::Vector3d> positions;
+    std::vector<double>          roadCoordinate;  // sorted transverse coordinates
+    std::vector<std::size_t>     roadOrder;       // hit indices in the order of roadCoordinate
+    double                       roadHalfWidth;   // window half-width towards the next layer
+  };
+
   Eigen::VectorXd m_layerWeights;
 
   Eigen::Vector3d m_optimumDirection;
+  Eigen::Vector3d m_roadAxis;
+
+  void fillLayerHits(const std::vector<gsl::not_null<const edm4hep::TrackerHitCollection*>>& hits,
+                     std::vector<LayerHits>& layers) const;
 
-  void
-  buildMatrixRecursive(int level, Eigen::MatrixXd* hitMatrix,
-                       const std::vector<gsl::not_null<const edm4hep::TrackerHitCollection*>>& hits,
-                       gsl::not_null<edm4eic::TrackSegmentCollection*> outputTracks) const;
+  template <int N>
+  void buildMatrixRecursive(int level, Eigen::Matrix<double, 3, N>& hitMatrix,
+                            const std::vector<LayerHits>& layers,
+                            std::vector<std::vector<std::size_t>>& candidates,
+                            gsl::not_null<edm4eic::TrackSegmentCollection*> outputTracks) const;
 
-  void checkHitCombination(Eigen::MatrixXd* hitMatrix,
+  template <int N>
+  void checkHitCombination(const Eigen::Matrix<double, 3, N>& hitMatrix,
                            gsl::not_null<edm4eic::TrackSegmentCollection*> outputTracks) const;
 
   bool checkHitPair(const Eigen::Vector3d& hit1, const Eigen::Vector3d& hit2) const;
@@ -6,7 +6,11 @@
 namespace eicrecon {
   struct FarDetectorLinearTrackingConfig {
 
+    // Maximum hits per layer when every hit combination is fitted
     int   layer_hits_max{10};
+    // Maximum hits per layer when restrict_direction is on, larger since the
+    // candidates come from a road search around the optimum direction
+    int   road_layer_hits_max{1000};
     float chi2_max{0.001};
     int   n_layer{4};
 
@@ -2,12 +2,14 @@
 // Copyright (C) 2024, Simon Gardner
 
 #include <TMVA/IMethod.h>
+#include <algorithms/service.h>
 #include <edm4eic/Cov6f.h>
 #include <edm4eic/vector_utils.h>
 #include <edm4hep/Vector2f.h>
 #include <edm4hep/Vector3f.h>
 #include <edm4hep/utils/vector_utils.h>
 #include <fmt/core.h>
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include <exception>
@@ -16,13 +18,36 @@
 
 #include "FarDetectorMLReconstruction.h"
 #include "algorithms/fardetectors/FarDetectorMLReconstructionConfig.h"
+#ifdef USE_ONNX
+#include "services/onnx/ONNXInferenceSvc.h"
+#endif
 
 namespace eicrecon {
 
 
   void FarDetectorMLReconstruction::init() {
 
-    m_reader = new TMVA::Reader( "!Color:!Silent" );
+    if(m_cfg.modelPath.empty()){
+      error("No model path provided for FarDetectorMLReconstruction");
+      return;
+    }
+
+    if(m_cfg.backend == "TMVA"){
+      initTMVA();
+    } else if(m_cfg.backend == "ONNX"){
+#ifdef USE_ONNX
+      initONNX();
+#else
+      error("ONNX backend requested for FarDetectorMLReconstruction, but EICrecon was built without ONNX support");
+#endif
+    } else {
+      error("Unknown backend {} for FarDetectorMLReconstruction, expected TMVA or ONNX", m_cfg.backend);
+    }
+  }
+
+  void FarDetectorMLReconstruction::initTMVA() {
+
+    m_reader = std::make_unique<TMVA::Reader>( "!Color:!Silent" );
     // Create a set of variables and declare them to the reader
     // - the variable names MUST corresponds in name and type to those given in the weight file(s) used
     m_reader->AddVariable( "LowQ2Tracks[0].loc.a", &nnInput[FarDetectorMLNNIndexIn::PosY] );
@@ -31,26 +56,89 @@ namespace eicrecon {
     m_reader->AddVariable( "cos(LowQ2Tracks[0].phi)*sin(LowQ2Tracks[0].theta)", &nnInput[FarDetectorMLNNIndexIn::DirY] );
 
     // Locate and load the weight file
-    // TODO - Add functionality to select passed by configuration
-    bool methodFound = false;
-    if(!m_cfg.modelPath.empty()){
-      try{
-        m_method = dynamic_cast<TMVA::MethodBase*>(m_reader->BookMVA( m_cfg.methodName, m_cfg.modelPath ));
-      }
-      catch(std::exception &e){
-        error(fmt::format("Failed to load method {} from file {}: {}", m_cfg.methodName, m_cfg.modelPath, e.what()));
+    try{
+      m_method = dynamic_cast<TMVA::MethodBase*>(m_reader->BookMVA( m_cfg.methodName, m_cfg.modelPath ));
+    }
+    catch(std::exception &e){
+      error(fmt::format("Failed to load method {} from file {}: {}", m_cfg.methodName, m_cfg.modelPath, e.what()));
+    }
+  }
+
+#ifdef USE_ONNX
+  void FarDetectorMLReconstruction::initONNX() {
+
+    auto& serviceSvc = algorithms::ServiceSvc::instance();
+    auto onnx_svc = serviceSvc.service<ONNXInferenceSvc>("ONNXInferenceSvc");
+
+    m_session = onnx_svc->load(m_cfg.modelPath);
+    if(m_session == nullptr){
+      error("Failed to load ONNX model {}", m_cfg.modelPath);
+      return;
+    }
+    if(m_session->inputRowSize() != FarDetectorMLNNInputs || m_session->outputRowSize() != FarDetectorMLNNOutputs
+    || m_session->batchDimension() >= 0){
+      error("ONNX model {} must map a dynamic batch of {} inputs to {} outputs", m_cfg.modelPath,
+            FarDetectorMLNNInputs, FarDetectorMLNNOutputs);
+      m_session = nullptr;
+      return;
+    }
+    m_useONNX = true;
+  }
+#endif
+
+
+  void FarDetectorMLReconstruction::evaluate(const std::vector<float>& inputs, std::vector<float>& outputs, std::size_t nTracks) const {
+
+    outputs.resize(nTracks * FarDetectorMLNNOutputs);
+
+    const std::size_t batchSize = (m_cfg.batchSize == 0) ? nTracks : m_cfg.batchSize;
+    for(std::size_t first = 0; first < nTracks; first += batchSize){
+      const std::size_t n   = std::min(batchSize, nTracks - first);
+      const float* batchIn  = inputs.data()  + first * FarDetectorMLNNInputs;
+      float*       batchOut = outputs.data() + first * FarDetectorMLNNOutputs;
+#ifdef USE_ONNX
+      if(m_useONNX){
+        evaluateONNX(batchIn, batchOut, n);
+        continue;
       }
+#endif
+      evaluateTMVA(batchIn, batchOut, n);
+    }
+  }
 
-    } else {
-      error("No model path provided for FarDetectorMLReconstruction");
+  void FarDetectorMLReconstruction::evaluateTMVA(const float* inputs, float* outputs, std::size_t nTracks) const {
+
+    if(m_method == nullptr){
+      std::fill(outputs, outputs + nTracks * FarDetectorMLNNOutputs, 0.0f);
+      return;
+    }
+
+    // One lock per batch rather than per track
+    std::lock_guard<std::mutex> lock(m_tmvaMutex);
+    for(std::size_t i = 0; i < nTracks; i++){
+      std::copy_n(inputs + i * FarDetectorMLNNInputs, FarDetectorMLNNInputs, nnInput);
+      const auto& values = m_method->GetRegressionValues();
+      std::copy_n(values.begin(), FarDetectorMLNNOutputs, outputs + i * FarDetectorMLNNOutputs);
     }
   }
 
+#ifdef USE_ONNX
+  void FarDetectorMLReconstruction::evaluateONNX(const float* inputs, float* outputs, std::size_t nTracks) const {
+
+    // Concurrent events may be merged into one inference by the session
+    try {
+      m_session->run(inputs, nTracks, outputs);
+    } catch (const std::exception& exception) {
+      error("error running model inference: {}", exception.what());
+      std::fill(outputs, outputs + nTracks * FarDetectorMLNNOutputs, 0.0f);
+    }
+  }
+#endif
 
 
   void FarDetectorMLReconstruction::process(
       const FarDetectorMLReconstruction::Input& input,
-      const FarDetectorMLReconstruction::Output& output) {
+      const FarDetectorMLReconstruction::Output& output) const {
 
     const auto [inputTracks,beamElectrons] = input;
     auto [outputFarDetectorMLTrajectories, outputFarDetectorMLTrackParameters, outputFarDetectorMLTracks] = output;
@@ -67,22 +155,40 @@ namespace eicrecon {
       m_beamE = round(m_beamE);
     });
 
-    // Reconstructed particle members which don't change
-    std::int32_t type   = 0; // Check?
-    float        charge = -1;
+    const std::size_t nTracks = inputTracks->size();
+    if(nTracks == 0){
+      return;
+    }
 
-    for(const auto& track: *inputTracks){
+    // Gather the network inputs for all tracks of the event into one batch,
+    // the buffers are kept per thread so their capacity is reused between events
+    thread_local std::vector<float> nnInputs;
+    thread_local std::vector<float> nnOutputs;
+    nnInputs.resize(nTracks * FarDetectorMLNNInputs);
+
+    for(std::size_t i = 0; i < nTracks; i++){
+      const auto track = (*inputTracks)[i];
 
       auto pos        = track.getLoc();
       auto trackphi   = track.getPhi();
       auto tracktheta = track.getTheta();
 
-      nnInput[FarDetectorMLNNIndexIn::PosY] = pos.a;
-      nnInput[FarDetectorMLNNIndexIn::PosZ] = pos.b;
-      nnInput[FarDetectorMLNNIndexIn::DirX] = sin(trackphi)*sin(tracktheta);
-      nnInput[FarDetectorMLNNIndexIn::DirY] = cos(trackphi)*sin(tracktheta);
+      float* row = nnInputs.data() + i * FarDetectorMLNNInputs;
+      row[FarDetectorMLNNIndexIn::PosY] = pos.a;
+      row[FarDetectorMLNNIndexIn::PosZ] = pos.b;
+      row[FarDetectorMLNNIndexIn::DirX] = sin(trackphi)*sin(tracktheta);
+      row[FarDetectorMLNNIndexIn::DirY] = cos(trackphi)*sin(tracktheta);
+    }
+
+    evaluate(nnInputs, nnOutputs, nTracks);
+
+    // Reconstructed particle members which don't change
+    std::int32_t type   = 0; // Check?
+    float        charge = -1;
+
+    for(std::size_t i = 0; i < nTracks; i++){
 
-      auto values = m_method->GetRegressionValues();
+      const float* values = nnOutputs.data() + i * FarDetectorMLNNOutputs;
 
       edm4hep::Vector3f momentum = {values[FarDetectorMLNNIndexOut::MomX],values[FarDetectorMLNNIndexOut::MomY],values[FarDetectorMLNNIndexOut::MomZ]};
 
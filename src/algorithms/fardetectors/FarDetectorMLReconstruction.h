@@ -11,9 +11,15 @@
 #include <edm4eic/TrajectoryCollection.h>
 // Event Model related classes
 #include <edm4hep/MCParticleCollection.h>
+#include <cstddef>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <string_view>
+#include <vector>
+#ifdef USE_ONNX
+#include "services/onnx/ONNXInferenceSession.h"
+#endif
 
 #include "FarDetectorMLReconstructionConfig.h"
 #include "algorithms/interfaces/WithPodConfig.h"
@@ -23,6 +29,10 @@ namespace eicrecon {
   enum FarDetectorMLNNIndexIn{PosY,PosZ,DirX,DirY};
   enum FarDetectorMLNNIndexOut{MomX,MomY,MomZ};
 
+  /// Number of network inputs and outputs per track
+  constexpr std::size_t FarDetectorMLNNInputs  = 4;
+  constexpr std::size_t FarDetectorMLNNOutputs = 3;
+
   using FarDetectorMLReconstructionAlgorithm = algorithms::Algorithm<
     algorithms::Input<
       edm4eic::TrackParametersCollection,
@@ -51,16 +61,35 @@ namespace eicrecon {
       void init();
 
       /** Event by event processing **/
-      void process(const Input&, const Output&);
+      void process(const Input&, const Output&) const;
+
+      /** Evaluate the network on a batch of nTracks rows of FarDetectorMLNNInputs inputs,
+       *  filling nTracks rows of FarDetectorMLNNOutputs prescaled momentum components **/
+      void evaluate(const std::vector<float>& inputs, std::vector<float>& outputs, std::size_t nTracks) const;
 
       //----- Define constants here ------
 
   private:
-      TMVA::Reader*     m_reader{nullptr};
+      void initTMVA();
+      void evaluateTMVA(const float* inputs, float* outputs, std::size_t nTracks) const;
+
+      std::unique_ptr<TMVA::Reader> m_reader{nullptr};
       TMVA::MethodBase* m_method{nullptr};
-      float m_beamE{10.0};
-      std::once_flag m_initBeamE;
-      float nnInput[4]  = {0.0,0.0,0.0,0.0};
+      /// The TMVA reader evaluates the variables bound to nnInput, so access has to be serialized
+      mutable std::mutex m_tmvaMutex;
+      mutable float nnInput[FarDetectorMLNNInputs] = {0.0,0.0,0.0,0.0};
+
+#ifdef USE_ONNX
+      void initONNX();
+      void evaluateONNX(const float* inputs, float* outputs, std::size_t nTracks) const;
+
+      /// Shared session owned by ONNXInferenceSvc, safe to run concurrently
+      const ONNXInferenceSession* m_session{nullptr};
+#endif
+
+      bool m_useONNX{false};
+      mutable float m_beamE{10.0};
+      mutable std::once_flag m_initBeamE;
 
   };
 
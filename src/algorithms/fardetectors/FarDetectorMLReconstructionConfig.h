@@ -4,6 +4,8 @@
 #pragma once
 
 #include <DD4hep/DD4hepUnits.h>
+#include <cstddef>
+#include <string>
 
 namespace eicrecon {
   struct FarDetectorMLReconstructionConfig {
@@ -11,5 +13,11 @@ namespace eicrecon {
     std::string modelPath;
     std::string methodName;
 
+    /** Inference backend: "TMVA" (weights xml) or "ONNX" (model with 4 inputs and 3 outputs per track) */
+    std::string backend{"TMVA"};
+    /** Maximum number of tracks evaluated in one inference call, 0 evaluates the whole event at once.
+     *  With the ONNX backend, batches of concurrent events are further merged by ONNXInferenceSvc */
+    std::size_t batchSize{0};
+
   };
 }
@@ -14,14 +14,113 @@
 #include <Math/GenVector/DisplacementVector3D.h>
 #include <edm4hep/Vector3f.h>
 #include <edm4hep/utils/vector_utils.h>
+#include <fmt/core.h>
 #include <cmath>
+#include <fstream>
 #include <gsl/pointers>
+#include <sstream>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 #include "algorithms/fardetectors/MatrixTransferStaticConfig.h"
 
 void eicrecon::MatrixTransferStatic::init() {
 
+  m_beamSettings.clear();
+
+  // Settings from file are matched first, so they can override the built-in ones
+  if (!m_cfg.matrixFile.empty()) {
+    loadBeamSettings(m_cfg.matrixFile);
+  }
+
+  {
+    const double aX[2][2] = {{3.251116, 30.285734}, {0.186036375, 0.196439472}};
+    const double aY[2][2] = {{0.4730500000, 3.062999454}, {0.0204108951, -0.139318692}};
+    addBeamSetting(275.0, aX, aY, -0.339334, -0.000299454, -0.219603248, -0.000176128);
+  }
+  {
+    const double aX[2][2] = {{3.152158, 20.852072}, {0.181649517, -0.303998487}};
+    const double aY[2][2] = {{0.5306100000, 3.19623343}, {0.0226283320, -0.082666019}};
+    addBeamSetting(100.0, aX, aY, -0.329072, -0.00028343, -0.218525084, -0.00015321);
+  }
+  {
+    const double aX[2][2] = {{3.135997, 18.482273}, {0.176479921, -0.497839483}};
+    const double aY[2][2] = {{0.4914400000, 4.53857451}, {0.0179664765, 0.004160679}};
+    addBeamSetting(41.0, aX, aY, -0.283273, -0.00552451, -0.21174031, -0.003212011);
+  }
+  { //135 GeV deuterons
+    const double aX[2][2] = {{1.6248, 12.966293}, {0.1832, -2.8636535}};
+    const double aY[2][2] = {{0.0001674, -28.6003}, {0.0000837, -2.87985}};
+    addBeamSetting(135.0, aX, aY, -11.9872, -0.0146, -14.75315, -0.0073);
+  }
+
+}
+
+void eicrecon::MatrixTransferStatic::addBeamSetting(
+    double nomMomentum, const double aX[2][2], const double aY[2][2],
+    double local_x_offset, double local_y_offset,
+    double local_x_slope_offset, double local_y_slope_offset) {
+
+  const double detX = aX[0][0] * aX[1][1] - aX[0][1] * aX[1][0];
+  const double detY = aY[0][0] * aY[1][1] - aY[0][1] * aY[1][0];
+
+  if (detX == 0 || detY == 0) {
+    error("Reco matrix determinant = 0 for {} GeV! Matrix cannot be inverted! Double-check matrix!", nomMomentum);
+    throw std::runtime_error("Reco matrix cannot be inverted");
+  }
+
+  BeamSetting setting{};
+  setting.nomMomentum = nomMomentum;
+
+  setting.aXinv[0][0] =  aX[1][1] / detX;
+  setting.aXinv[0][1] = -aX[0][1] / detX;
+  setting.aXinv[1][0] = -aX[1][0] / detX;
+  setting.aXinv[1][1] =  aX[0][0] / detX;
+
+  setting.aYinv[0][0] =  aY[1][1] / detY;
+  setting.aYinv[0][1] = -aY[0][1] / detY;
+  setting.aYinv[1][0] = -aY[1][0] / detY;
+  setting.aYinv[1][1] =  aY[0][0] / detY;
+
+  setting.local_x_offset       = local_x_offset;
+  setting.local_y_offset       = local_y_offset;
+  setting.local_x_slope_offset = local_x_slope_offset;
+  setting.local_y_slope_offset = local_y_slope_offset;
+
+  m_beamSettings.push_back(setting);
+}
+
+void eicrecon::MatrixTransferStatic::loadBeamSettings(const std::string& filename) {
+
+  std::ifstream file(filename);
+  if (!file) {
+    error("Cannot open matrix file {}", filename);
+    throw std::runtime_error(fmt::format("Cannot open matrix file {}", filename));
+  }
+
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::istringstream ss(line);
+    double nomMomentum;
+    double aX[2][2];
+    double aY[2][2];
+    double offsets[4];
+    ss >> nomMomentum
+       >> aX[0][0] >> aX[0][1] >> aX[1][0] >> aX[1][1]
+       >> aY[0][0] >> aY[0][1] >> aY[1][0] >> aY[1][1]
+       >> offsets[0] >> offsets[1] >> offsets[2] >> offsets[3];
+    if (ss.fail()) {
+      error("Malformed line in matrix file {}: {}", filename, line);
+      throw std::runtime_error(fmt::format("Malformed line in matrix file {}", filename));
+    }
+    addBeamSetting(nomMomentum, aX, aY, offsets[0], offsets[1], offsets[2], offsets[3]);
+  }
+
+  debug("Loaded {} beam settings from {}", m_beamSettings.size(), filename);
 }
 
 void eicrecon::MatrixTransferStatic::process(
@@ -31,21 +130,6 @@ void eicrecon::MatrixTransferStatic::process(
   const auto [mcparts, rechits] = input;
   auto [outputParticles] = output;
 
-  std::vector<std::vector<double>> aX(m_cfg.aX);
-  std::vector<std::vector<double>> aY(m_cfg.aY);
-
-  //----- Define constants here ------
-  double aXinv[2][2] = {{0.0, 0.0},
-                        {0.0, 0.0}};
-  double aYinv[2][2] = {{0.0, 0.0},
-                        {0.0, 0.0}};
-
-  double nomMomentum     = m_cfg.nomMomentum; //extract the nominal value first -- will be overwritten by MCParticle
-  double local_x_offset  = m_cfg.local_x_offset;
-  double local_y_offset  = m_cfg.local_y_offset;
-  double local_x_slope_offset  = m_cfg.local_x_slope_offset;
-  double local_y_slope_offset  = m_cfg.local_y_slope_offset;
-
   double numBeamProtons = 0;
   double runningMomentum = 0.0;
 
@@ -62,114 +146,31 @@ void eicrecon::MatrixTransferStatic::process(
 
   if(numBeamProtons == 0) {error("No beam protons to choose matrix!! Skipping!!"); return;}
 
-  nomMomentum = runningMomentum/numBeamProtons;
+  const double nomMomentum = runningMomentum/numBeamProtons;
 
   double nomMomentumError = 0.05;
 
   //This is a temporary solution to get the beam energy information
   //needed to select the correct matrix
 
-  if(abs(275.0 - nomMomentum)/275.0 < nomMomentumError){
-
-     aX[0][0] = 3.251116; //a
-     aX[0][1] = 30.285734; //b
-     aX[1][0] = 0.186036375; //c
-     aX[1][1] = 0.196439472; //d
-
-     aY[0][0] = 0.4730500000; //a
-     aY[0][1] = 3.062999454; //b
-     aY[1][0] = 0.0204108951; //c
-     aY[1][1] = -0.139318692; //d
-
-     local_x_offset       = -0.339334;
-     local_y_offset       = -0.000299454;
-     local_x_slope_offset = -0.219603248;
-     local_y_slope_offset = -0.000176128;
-
-  }
-  else if(abs(100.0 - nomMomentum)/100.0 < nomMomentumError){
-
-     aX[0][0] = 3.152158; //a
-     aX[0][1] = 20.852072; //b
-     aX[1][0] = 0.181649517; //c
-     aX[1][1] = -0.303998487; //d
-
-     aY[0][0] = 0.5306100000; //a
-     aY[0][1] = 3.19623343; //b
-     aY[1][0] = 0.0226283320; //c
-     aY[1][1] = -0.082666019; //d
-
-     local_x_offset       = -0.329072;
-     local_y_offset       = -0.00028343;
-     local_x_slope_offset = -0.218525084;
-     local_y_slope_offset = -0.00015321;
-
-  }
-  else if(abs(41.0 - nomMomentum)/41.0 < nomMomentumError){
-
-         aX[0][0] = 3.135997; //a
-         aX[0][1] = 18.482273; //b
-         aX[1][0] = 0.176479921; //c
-         aX[1][1] = -0.497839483; //d
-
-         aY[0][0] = 0.4914400000; //a
-         aY[0][1] = 4.53857451; //b
-         aY[1][0] = 0.0179664765; //c
-         aY[1][1] = 0.004160679; //d
-
-         local_x_offset       = -0.283273;
-         local_y_offset       = -0.00552451;
-         local_x_slope_offset = -0.21174031;
-         local_y_slope_offset = -0.003212011;
-
-  }
-  else if(abs(135.0 - nomMomentum)/135.0 < nomMomentumError){ //135 GeV deuterons
-
-      aX[0][0] = 1.6248;
-      aX[0][1] = 12.966293;
-      aX[1][0] = 0.1832;
-      aX[1][1] = -2.8636535;
-
-      aY[0][0] = 0.0001674; //a
-      aY[0][1] = -28.6003; //b
-      aY[1][0] = 0.0000837; //c
-      aY[1][1] = -2.87985; //d
-
-      local_x_offset       = -11.9872;
-      local_y_offset       = -0.0146;
-      local_x_slope_offset = -14.75315;
-      local_y_slope_offset = -0.0073;
-
+  const BeamSetting* setting = nullptr;
+  for (const auto& s : m_beamSettings) {
+    if (std::abs(s.nomMomentum - nomMomentum)/s.nomMomentum < nomMomentumError) {
+      setting = &s;
+      break;
+    }
   }
-  else {
+  if (setting == nullptr) {
     error("MatrixTransferStatic:: No valid matrix found to match beam momentum!! Skipping!!");
     return;
   }
 
-  double determinant = aX[0][0] * aX[1][1] - aX[0][1] * aX[1][0];
-
-  if (determinant == 0) {
-    error("Reco matrix determinant = 0! Matrix cannot be inverted! Double-check matrix!");
-    return;
-  }
-
-  aXinv[0][0] =  aX[1][1] / determinant;
-  aXinv[0][1] = -aX[0][1] / determinant;
-  aXinv[1][0] = -aX[1][0] / determinant;
-  aXinv[1][1] =  aX[0][0] / determinant;
-
-
-  determinant = aY[0][0] * aY[1][1] - aY[0][1] * aY[1][0];
-
-  if (determinant == 0) {
-    error("Reco matrix determinant = 0! Matrix cannot be inverted! Double-check matrix!");
-    return;
-  }
-
-  aYinv[0][0] =  aY[1][1] / determinant;
-  aYinv[0][1] = -aY[0][1] / determinant;
-  aYinv[1][0] = -aY[1][0] / determinant;
-  aYinv[1][1] =  aY[0][0] / determinant;
+  const auto& aXinv = setting->aXinv;
+  const auto& aYinv = setting->aYinv;
+  const double local_x_offset       = setting->local_x_offset;
+  const double local_y_offset       = setting->local_y_offset;
+  const double local_x_slope_offset = setting->local_x_slope_offset;
+  const double local_y_slope_offset = setting->local_y_slope_offset;
 
   //---- begin Reconstruction code ----
 
@@ -182,13 +183,14 @@ void eicrecon::MatrixTransferStatic::process(
   bool goodHit1 = false;
   bool goodHit2 = false;
 
+  auto volman = m_detector->volumeManager();
+
   for (const auto &h: *rechits) {
 
     auto cellID = h.getCellID();
     // The actual hit position in Global Coordinates
     auto gpos = m_converter->position(cellID);
     // local positions
-    auto volman = m_detector->volumeManager();
     auto local = volman.lookupDetElement(cellID);
 
     auto pos0 = local.nominal().worldToLocal(dd4hep::Position(gpos.x(), gpos.y(), gpos.z())); // hit position in local coordinates
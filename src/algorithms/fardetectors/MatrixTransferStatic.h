@@ -13,6 +13,7 @@
 #include <gsl/pointers>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include "MatrixTransferStaticConfig.h"
 #include "algorithms/interfaces/WithPodConfig.h"
@@ -44,6 +45,24 @@ namespace eicrecon {
     void process(const Input&, const Output&) const final;
 
   private:
+    // Transfer matrix set for one beam momentum, inverted in init()
+    struct BeamSetting {
+      double nomMomentum;
+      double aXinv[2][2];
+      double aYinv[2][2];
+      double local_x_offset;
+      double local_y_offset;
+      double local_x_slope_offset;
+      double local_y_slope_offset;
+    };
+
+    void addBeamSetting(double nomMomentum, const double aX[2][2], const double aY[2][2],
+                        double local_x_offset, double local_y_offset,
+                        double local_x_slope_offset, double local_y_slope_offset);
+    void loadBeamSettings(const std::string& filename);
+
+    std::vector<BeamSetting> m_beamSettings;
+
     const dd4hep::Detector* m_detector{algorithms::GeoSvc::instance().detector()};
     const dd4hep::rec::CellIDPositionConverter* m_converter{algorithms::GeoSvc::instance().cellIDPositionConverter()};
 
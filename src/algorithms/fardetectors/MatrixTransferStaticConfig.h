@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include <string>
+#include <vector>
+
 namespace eicrecon {
 
   struct MatrixTransferStaticConfig {
@@ -42,6 +45,11 @@ namespace eicrecon {
 
     std::string readout{""};
 
+    // Optional text file with additional beam settings, one per line:
+    //   nomMomentum aX00 aX01 aX10 aX11 aY00 aY01 aY10 aY11 x_offset y_offset x_slope_offset y_slope_offset
+    // Lines starting with '#' are ignored. Settings from the file take precedence over the built-in ones.
+    std::string matrixFile{""};
+
   };
 
 }
@@ -0,0 +1,201 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2024 EICrecon Authors
+
+#include "algorithms/interfaces/CellIDGeometrySvc.h"
+
+#include <DD4hep/IDDescriptor.h>
+#include <DD4hep/Readout.h>
+#include <DD4hep/VolumeManager.h>
+#include <DD4hep/detail/VolumeManagerInterna.h>
+#include <DDSegmentation/BitFieldCoder.h>
+#include <TGeoMatrix.h>
+#include <algorithms/geo.h>
+#include <algorithm>
+#include <exception>
+#include <unordered_map>
+
+namespace eicrecon {
+
+void CellIDGeometrySvc::init() {
+  auto& geo   = algorithms::GeoSvc::instance();
+  m_detector  = geo.detector();
+  m_converter = geo.cellIDPositionConverter();
+
+  for (const auto& name : m_readout_names.value()) {
+    try {
+      addReadout(name);
+    } catch (const std::exception& e) {
+      warning("Readout {} not tabulated: {}", name, e.what());
+    }
+  }
+
+  // The system ID alone does not identify the readout when a subdetector has
+  // several of them; those cells are resolved by their volume ID
+  for (auto& table : m_readouts) {
+    for (const auto& other : m_readouts) {
+      if (&other != &table && other.systemValue == table.systemValue) {
+        debug("Readouts {} and {} share system ID {:#x}", table.name, other.name, table.systemValue);
+        table.sharedSystem = true;
+      }
+    }
+  }
+  if (!m_readouts.empty()) {
+    info("Tabulated {} volumes in {} readouts", m_entries.size(), m_readouts.size());
+  }
+}
+
+void CellIDGeometrySvc::addReadout(const std::string& name) {
+  dd4hep::Readout readout = m_detector->readout(name);
+
+  // Find the subdetector that this readout belongs to
+  dd4hep::DetElement subdetector;
+  for (const auto& [sd_name, sd_handle] : m_detector->sensitiveDetectors()) {
+    dd4hep::SensitiveDetector sd(sd_handle);
+    if (sd.readout().isValid() && sd.readout().name() == name) {
+      subdetector = m_detector->detector(sd_name);
+      break;
+    }
+  }
+  if (!subdetector.isValid()) {
+    warning("Readout {} has no sensitive detector, skipping", name);
+    return;
+  }
+
+  const auto* system_field = readout.idSpec().field("system");
+  const VolumeID system_mask  = system_field->mask();
+  const VolumeID system_value = (static_cast<VolumeID>(subdetector.id()) << system_field->offset()) & system_mask;
+
+  auto volman = m_detector->volumeManager();
+  const auto& subdetectors = volman.ptr()->subdetectors;
+  auto manager = subdetectors.find(subdetector);
+  if (manager == subdetectors.end()) {
+    warning("Readout {} has no volume manager for {}, skipping", name, subdetector.name());
+    return;
+  }
+  const auto& volumes = manager->second.ptr()->volumes;
+  if (volumes.empty()) {
+    return;
+  }
+
+  // All sensitive volumes of a readout are expected to be identified by the
+  // same fields, otherwise a single masked lookup is not possible
+  const VolumeID volume_mask = volumes.begin()->second->mask;
+  for (const auto& [volume_id, context] : volumes) {
+    if (context->mask != volume_mask) {
+      warning("Readout {} has volumes with different masks, skipping", name);
+      return;
+    }
+  }
+
+  std::unordered_map<const void*, std::uint32_t> element_index;
+  for (const auto& element : m_elements) {
+    element_index.emplace(element.ptr(), element_index.size());
+  }
+
+  ReadoutTable table{name, system_mask, system_value, volume_mask,
+                     readout.segmentation().segmentation(), m_entries.size(), 0, false};
+  const auto readout_index = static_cast<std::uint32_t>(m_readouts.size());
+
+  for (const auto& [volume_id, context] : volumes) {
+    // Same composition as CellIDPositionConverter::position()
+    TGeoHMatrix to_world(context->element.nominal().worldTransformation());
+    to_world.Multiply(&context->toElement());
+    const double* r = to_world.GetRotationMatrix();
+    const double* t = to_world.GetTranslation();
+
+    auto [it, inserted] = element_index.emplace(context->element.ptr(), m_elements.size());
+    if (inserted) {
+      m_elements.push_back(context->element);
+    }
+
+    m_entries.push_back({
+      volume_id,
+      {r[0], r[1], r[2], t[0], r[3], r[4], r[5], t[1], r[6], r[7], r[8], t[2]},
+      readout_index,
+      it->second
+    });
+  }
+
+  table.end = m_entries.size();
+  std::sort(m_entries.begin() + table.begin, m_entries.begin() + table.end,
+            [](const Entry& a, const Entry& b) { return a.volumeID < b.volumeID; });
+  debug("Readout {}: {} volumes, volume mask {:#018x}", name, table.end - table.begin, volume_mask);
+  m_readouts.push_back(std::move(table));
+}
+
+const CellIDGeometrySvc::ReadoutTable* CellIDGeometrySvc::findReadout(CellID cell) const {
+  const ReadoutTable* found = nullptr;
+  for (const auto& table : m_readouts) {
+    if ((cell & table.systemMask) != table.systemValue) {
+      continue;
+    }
+    if (!table.sharedSystem) {
+      return &table;
+    }
+    // Match on the full volume ID, and refuse to guess if that is ambiguous
+    if (findEntry(table, cell) != nullptr) {
+      if (found != nullptr) {
+        return nullptr;
+      }
+      found = &table;
+    }
+  }
+  return found;
+}
+
+const CellIDGeometrySvc::Entry* CellIDGeometrySvc::findEntry(const ReadoutTable& table, CellID cell) const {
+  const VolumeID volume_id = cell & table.volumeMask;
+  auto first = m_entries.begin() + table.begin;
+  auto last  = m_entries.begin() + table.end;
+  auto it = std::lower_bound(first, last, volume_id,
+                             [](const Entry& e, VolumeID id) { return e.volumeID < id; });
+  if (it == last || it->volumeID != volume_id) {
+    return nullptr;
+  }
+  return &*it;
+}
+
+const CellIDGeometrySvc::Entry* CellIDGeometrySvc::find(CellID cell) const {
+  const auto* table = findReadout(cell);
+  if (table == nullptr) {
+    return nullptr;
+  }
+  return findEntry(*table, cell);
+}
+
+dd4hep::Position CellIDGeometrySvc::position(CellID cell) const {
+  const auto* entry = find(cell);
+  if (entry == nullptr) {
+    return m_converter->position(cell);
+  }
+  const auto local = m_readouts[entry->readoutIndex].segmentation->position(cell);
+  const auto& m = entry->transform;
+  return {
+    m[0] * local.X + m[1] * local.Y + m[2]  * local.Z + m[3],
+    m[4] * local.X + m[5] * local.Y + m[6]  * local.Z + m[7],
+    m[8] * local.X + m[9] * local.Y + m[10] * local.Z + m[11]
+  };
+}
+
+std::vector<double> CellIDGeometrySvc::cellDimensions(CellID cell) const {
+  const auto* table = findReadout(cell);
+  if (table == nullptr) {
+    return m_converter->cellDimensions(cell);
+  }
+  return table->segmentation->cellDimensions(cell);
+}
+
+const dd4hep::DDSegmentation::Segmentation* CellIDGeometrySvc::segmentation(CellID cell) const {
+  const auto* table = findReadout(cell);
+  return table != nullptr ? table->segmentation : nullptr;
+}
+
+dd4hep::DetElement CellIDGeometrySvc::detElement(CellID cell) const {
+  const auto* entry = find(cell);
+  if (entry == nullptr) {
+    return m_detector->volumeManager().lookupDetElement(cell);
+  }
+  return m_elements[entry->elementIndex];
+}
+
+} // namespace eicrecon
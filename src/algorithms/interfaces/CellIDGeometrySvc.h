@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2024 EICrecon Authors
+
+#pragma once
+
+#include <DD4hep/DetElement.h>
+#include <DD4hep/Detector.h>
+#include <DD4hep/Objects.h>
+#include <DDRec/CellIDPositionConverter.h>
+#include <DDSegmentation/Segmentation.h>
+#include <algorithms/logger.h>
+#include <algorithms/service.h>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace eicrecon {
+
+/**
+ * @brief Precomputed cell ID geometry for selected readouts.
+ *
+ * For every sensitive volume of the configured readouts the volume-to-world
+ * transformation, the segmentation and the detector element are tabulated
+ * once at initialization. A cell position is then a binary search on the
+ * volume ID, the segmentation's local position and one affine transform,
+ * instead of the volume manager and readout lookups that
+ * dd4hep::rec::CellIDPositionConverter repeats for every call.
+ *
+ * The table is immutable after init() and safe to share between threads.
+ * Cells of readouts that are not tabulated are passed on to the
+ * CellIDPositionConverter, so consumers can use this service unconditionally.
+ * Readouts are selected with `-Pdd4hep:cellid_table_readouts=...`.
+ */
+class CellIDGeometrySvc : public algorithms::LoggedService<CellIDGeometrySvc> {
+public:
+  using CellID   = dd4hep::CellID;
+  using VolumeID = dd4hep::VolumeID;
+
+  /// Trivially copyable table row, one per sensitive volume
+  struct Entry {
+    VolumeID volumeID;
+    /// Row-major 3x4 volume-to-world transformation
+    std::array<double, 12> transform;
+    std::uint32_t readoutIndex;
+    std::uint32_t elementIndex;
+  };
+
+  void init();
+
+  /// Returns the table row for the volume containing `cell`, or nullptr
+  const Entry* find(CellID cell) const;
+
+  /// Global position of the cell center
+  dd4hep::Position position(CellID cell) const;
+
+  /// Cell dimensions as given by the segmentation
+  std::vector<double> cellDimensions(CellID cell) const;
+
+  /// Segmentation of the readout containing `cell`, or nullptr if not tabulated
+  const dd4hep::DDSegmentation::Segmentation* segmentation(CellID cell) const;
+
+  /// Detector element of the volume containing `cell`
+  dd4hep::DetElement detElement(CellID cell) const;
+
+  std::size_t size() const { return m_entries.size(); }
+
+private:
+  struct ReadoutTable {
+    std::string name;
+    VolumeID systemMask;
+    VolumeID systemValue;
+    VolumeID volumeMask;
+    const dd4hep::DDSegmentation::Segmentation* segmentation;
+    std::size_t begin;
+    std::size_t end;
+    /// Another tabulated readout has the same system ID
+    bool sharedSystem;
+  };
+
+  /// Returns the readout that `cell` belongs to, or nullptr if none or more
+  /// than one tabulated readout contains its volume
+  const ReadoutTable* findReadout(CellID cell) const;
+  const Entry* findEntry(const ReadoutTable& table, CellID cell) const;
+  void addReadout(const std::string& name);
+
+  Property<std::vector<std::string>> m_readout_names{this, "readouts", {},
+      "Readouts for which the cell geometry is precomputed"};
+
+  const dd4hep::Detector* m_detector{nullptr};
+  const dd4hep::rec::CellIDPositionConverter* m_converter{nullptr};
+
+  std::vector<ReadoutTable> m_readouts;
+  std::vector<Entry> m_entries;
+  std::vector<dd4hep::DetElement> m_elements;
+
+  ALGORITHMS_DEFINE_LOGGED_SERVICE(CellIDGeometrySvc);
+};
+
+} // namespace eicrecon
@@ -4,6 +4,8 @@
 #pragma once
 
 #include <algorithms/service.h>
+#include <array>
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <string>
@@ -24,11 +26,32 @@ public:
 private:
   static const std::shared_ptr<ParticleMap> kParticleMap;
 
+  // Common PDG codes that are resolved through a dense table instead of the map
+  static constexpr std::array<int, 16> kFastPDG{
+    11, -11, 13, -13, 22, 111, 211, -211, 321, -321, 2212, -2212, 2112, -2112, 1000010020, 0
+  };
+  static constexpr int fastIndex(int pdg) {
+    for (std::size_t i = 0; i < kFastPDG.size(); ++i) {
+      if (kFastPDG[i] == pdg) {
+        return static_cast<int>(i);
+      }
+    }
+    return -1;
+  }
+
 public:
   virtual void init(std::shared_ptr<ParticleMap> map = kParticleMap) {
     if (map != nullptr) {
       m_particleMap = map;
     }
+    if (m_particleMap == nullptr) {
+      return;
+    }
+    // Node pointers stay valid as long as the map is not modified
+    for (std::size_t i = 0; i < kFastPDG.size(); ++i) {
+      auto it = m_particleMap->find(kFastPDG[i]);
+      m_fastParticles[i] = (it != m_particleMap->end()) ? &it->second : nullptr;
+    }
   }
 
   virtual std::shared_ptr<ParticleMap> particleMap() const {
@@ -36,14 +59,19 @@ public:
   };
 
   virtual Particle& particle(int pdg) const {
-    if (m_particleMap->count(pdg) == 0) {
+    if (const int i = fastIndex(pdg); i >= 0 && m_fastParticles[i] != nullptr) {
+      return *m_fastParticles[i];
+    }
+    auto it = m_particleMap->find(pdg);
+    if (it == m_particleMap->end()) {
       return m_particleMap->at(0);
     }
-    return m_particleMap->at(pdg);
+    return it->second;
   };
 
 protected:
   std::shared_ptr<ParticleMap> m_particleMap{nullptr};
+  std::array<Particle*, kFastPDG.size()> m_fastParticles{};
 
   ALGORITHMS_DEFINE_SERVICE(ParticleSvc)
 };
@@ -4,15 +4,13 @@
 #pragma once
 
 #include <algorithms/algorithm.h>
-#include <cstdint>
 #include <edm4eic/InclusiveKinematicsCollection.h>
-#include <onnxruntime_cxx_api.h>
 #include <string>
 #include <string_view>
-#include <vector>
 
 #include "algorithms/interfaces/WithPodConfig.h"
 #include "algorithms/onnx/InclusiveKinematicsMLConfig.h"
+#include "services/onnx/ONNXInferenceSession.h"
 
 namespace eicrecon {
 
@@ -36,16 +34,8 @@ public:
   void process(const Input&, const Output&) const final;
 
 private:
-  mutable Ort::Env m_env{nullptr};
-  mutable Ort::Session m_session{nullptr};
-
-  std::vector<std::string> m_input_names;
-  std::vector<const char*> m_input_names_char;
-  std::vector<std::vector<std::int64_t>> m_input_shapes;
-
-  std::vector<std::string> m_output_names;
-  std::vector<const char*> m_output_names_char;
-  std::vector<std::vector<std::int64_t>> m_output_shapes;
+  /// Shared session owned by ONNXInferenceSvc
+  const ONNXInferenceSession* m_session{nullptr};
 };
 
 } // namespace eicrecon
@@ -0,0 +1,35 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2024 EICrecon Authors
+
+#pragma once
+
+#include <Math/LorentzRotation.h>
+#include <Math/Vector4D.h>
+#include <edm4eic/ReconstructedParticle.h>
+#include <edm4hep/MCParticle.h>
+#include <optional>
+
+namespace eicrecon {
+
+  /// Per-event beam quantities shared by the inclusive kinematics and
+  /// hadronic final state algorithms, see BeamContextBuilder
+  struct BeamContext {
+    /// First beam electron and hadron (generator status 4)
+    std::optional<edm4hep::MCParticle> mc_beam_electron;
+    std::optional<edm4hep::MCParticle> mc_beam_hadron;
+
+    /// Beam four-momenta rounded to the nominal beam settings
+    ROOT::Math::PxPyPzEVector ei;
+    ROOT::Math::PxPyPzEVector pi;
+
+    /// Boost to the colinear frame, only set if both beams are found
+    ROOT::Math::LorentzRotation boost;
+
+    /// First final-state electron and its reconstructed match, if any
+    std::optional<edm4hep::MCParticle> mc_scattered_electron;
+    std::optional<edm4eic::ReconstructedParticle> rc_scattered_electron;
+
+    bool hasBeams() const { return mc_beam_electron.has_value() && mc_beam_hadron.has_value(); }
+  };
+
+} // namespace eicrecon
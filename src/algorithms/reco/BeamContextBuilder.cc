@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2024 EICrecon Authors
+
+#include "BeamContextBuilder.h"
+
+#include <edm4eic/EDM4eicVersion.h>
+#include <edm4hep/Vector3f.h>
+#include <gsl/pointers>
+#include <vector>
+
+#include "Beam.h"
+#include "Boost.h"
+
+namespace eicrecon {
+
+  void BeamContextBuilder::init() { }
+
+  void BeamContextBuilder::process(
+      const BeamContextBuilder::Input& input,
+      const BeamContextBuilder::Output& output) const {
+
+    const auto [mcparts, rcassoc] = input;
+    auto [context] = output;
+
+    *context = BeamContext{};
+
+    // Beams and scattered electron in a single pass over the MC particles
+    for (const auto& p : *mcparts) {
+      const auto status = p.getGeneratorStatus();
+      const auto pdg = p.getPDG();
+      if (status == 4) {
+        if (!context->mc_beam_electron && pdg == 11) {
+          context->mc_beam_electron = p;
+        } else if (!context->mc_beam_hadron && (pdg == 2212 || pdg == 2112)) {
+          context->mc_beam_hadron = p;
+        }
+      } else if (status == 1 && !context->mc_scattered_electron && pdg == 11) {
+        context->mc_scattered_electron = p;
+      }
+      if (context->hasBeams() && context->mc_scattered_electron) {
+        break;
+      }
+    }
+
+    if (context->mc_beam_electron) {
+      context->ei = round_beam_four_momentum(
+        context->mc_beam_electron->getMomentum(),
+        m_particleSvc.particle(context->mc_beam_electron->getPDG()).mass,
+        {-5.0, -10.0, -18.0},
+        0.0);
+    } else {
+      debug("No beam electron found");
+    }
+
+    if (context->mc_beam_hadron) {
+      context->pi = round_beam_four_momentum(
+        context->mc_beam_hadron->getMomentum(),
+        m_particleSvc.particle(context->mc_beam_hadron->getPDG()).mass,
+        {41.0, 100.0, 275.0},
+        m_crossingAngle);
+    } else {
+      debug("No beam hadron found");
+    }
+
+    if (context->hasBeams()) {
+      context->boost = determine_boost(context->ei, context->pi);
+    }
+
+    // Associate first scattered electron with reconstructed particles
+    if (context->mc_scattered_electron && rcassoc != nullptr) {
+      const auto ef_id = context->mc_scattered_electron->getObjectID();
+      for (const auto& assoc : *rcassoc) {
+        if (assoc.getSim().getObjectID() == ef_id) {
+          context->rc_scattered_electron = assoc.getRec();
+          break;
+        }
+      }
+    }
+  }
+
+} // namespace eicrecon
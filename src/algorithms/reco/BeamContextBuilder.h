@@ -0,0 +1,40 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2024 EICrecon Authors
+
+#pragma once
+
+#include <algorithms/algorithm.h>
+#include <edm4eic/MCRecoParticleAssociationCollection.h>
+#include <edm4hep/MCParticleCollection.h>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "BeamContext.h"
+#include "algorithms/interfaces/ParticleSvc.h"
+
+namespace eicrecon {
+
+using BeamContextBuilderAlgorithm = algorithms::Algorithm<
+    algorithms::Input<edm4hep::MCParticleCollection,
+                      std::optional<edm4eic::MCRecoParticleAssociationCollection>>,
+    algorithms::Output<BeamContext>>;
+
+class BeamContextBuilder : public BeamContextBuilderAlgorithm {
+
+public:
+  BeamContextBuilder(std::string_view name)
+      : BeamContextBuilderAlgorithm{name,
+                                    {"MCParticles", "inputAssociations"},
+                                    {"beamContext"},
+                                    "Determine beams, boost and scattered electron once per event."} {}
+
+  void init() final;
+  void process(const Input&, const Output&) const final;
+
+private:
+  const algorithms::ParticleSvc& m_particleSvc = algorithms::ParticleSvc::instance();
+  double m_crossingAngle{-0.025};
+};
+
+} // namespace eicrecon
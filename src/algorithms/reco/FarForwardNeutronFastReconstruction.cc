@@ -0,0 +1,169 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2024 Sebouh Paul, EICrecon Authors
+
+#include <edm4eic/CalorimeterHitCollection.h>
+#include <edm4eic/ClusterCollection.h>
+#include <edm4eic/ReconstructedParticleCollection.h>
+#include <edm4hep/Vector3f.h>
+#include <edm4hep/utils/vector_utils.h>
+#include <math.h>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <gsl/pointers>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+#include "FarForwardNeutronFastReconstruction.h"
+#include "FarForwardNeutronReconstruction.h"
+
+/**
+ Fast path for FarForwardNeutronReconstruction that works on calibrated hits instead of
+ clusters. The energy is the sum of all hit energies above min_hit_energy, with the HCAL hits
+ divided by the HCAL sampling fraction, and corrected with the same coefficients as
+ FarForwardNeutronReconstruction. The direction is the direction from the origin to the
+ energy-weighted centroid of the HCAL hits (rather than to the most energetic cluster). The
+ summed hits are attached to the candidate as one cluster per calorimeter. When a reference
+ candidate collection, e.g. from the full clustering chain, is given, each candidate is compared
+ to the reference candidate closest in angle and differences above validation_tolerance are
+ reported.
+ */
+
+namespace eicrecon {
+
+    void FarForwardNeutronFastReconstruction::init() {
+      if (m_cfg.scale_corr_coeff_hcal.size() < 3) {
+        error("Invalid configuration.  m_cfg.scale_corr_coeff_hcal should have at least 3 parameters");
+        throw std::runtime_error("Invalid configuration.  m_cfg.scale_corr_coeff_hcal should have at least 3 parameters");
+      }
+      if (m_cfg.scale_corr_coeff_ecal.size() < 3) {
+        error("Invalid configuration.  m_cfg.scale_corr_coeff_ecal should have at least 3 parameters");
+        throw std::runtime_error("Invalid configuration.  m_cfg.scale_corr_coeff_ecal should have at least 3 parameters");
+      }
+      if (m_cfg.hcal_sampling_fraction <= 0) {
+        error("Invalid configuration.  m_cfg.hcal_sampling_fraction should be positive");
+        throw std::runtime_error("Invalid configuration.  m_cfg.hcal_sampling_fraction should be positive");
+      }
+    }
+
+    void FarForwardNeutronFastReconstruction::process(const FarForwardNeutronFastReconstruction::Input& input,
+                      const FarForwardNeutronFastReconstruction::Output& output) const {
+      const auto [hitsHcal,hitsEcal,reference] = input;
+      auto [out_neutrons,out_clusters] = output;
+
+      // Single pass over the hits, no per-cluster bookkeeping
+      std::optional<edm4eic::MutableCluster> cluster_hcal;
+      double Etot_hcal=0, Etot_ecal=0;
+      double wx=0, wy=0, wz=0;
+      for (const auto& hit : *hitsHcal) {
+          if (hit.getEnergy() < m_cfg.min_hit_energy) {
+            continue;
+          }
+          const double E = hit.getEnergy() / m_cfg.hcal_sampling_fraction;
+          if (!cluster_hcal) {
+            cluster_hcal = out_clusters->create();
+          }
+          const auto& pos = hit.getPosition();
+          Etot_hcal += E;
+          wx += E * pos.x;
+          wy += E * pos.y;
+          wz += E * pos.z;
+          cluster_hcal->addToHits(hit);
+          cluster_hcal->addToHitContributions(E);
+      }
+      if (cluster_hcal && Etot_hcal > 0) {
+        cluster_hcal->setEnergy(Etot_hcal);
+        cluster_hcal->setNhits(cluster_hcal->hits_size());
+        cluster_hcal->setPosition({static_cast<float>(wx / Etot_hcal), static_cast<float>(wy / Etot_hcal), static_cast<float>(wz / Etot_hcal)});
+      }
+
+      std::optional<edm4eic::MutableCluster> cluster_ecal;
+      if (hitsEcal != nullptr) {
+        double ex=0, ey=0, ez=0;
+        for (const auto& hit : *hitsEcal) {
+            const double E = hit.getEnergy();
+            if (E < m_cfg.min_hit_energy) {
+              continue;
+            }
+            if (!cluster_ecal) {
+              cluster_ecal = out_clusters->create();
+            }
+            const auto& pos = hit.getPosition();
+            Etot_ecal += E;
+            ex += E * pos.x;
+            ey += E * pos.y;
+            ez += E * pos.z;
+            cluster_ecal->addToHits(hit);
+            cluster_ecal->addToHitContributions(E);
+        }
+        if (cluster_ecal && Etot_ecal > 0) {
+          cluster_ecal->setEnergy(Etot_ecal);
+          cluster_ecal->setNhits(cluster_ecal->hits_size());
+          cluster_ecal->setPosition({static_cast<float>(ex / Etot_ecal), static_cast<float>(ey / Etot_ecal), static_cast<float>(ez / Etot_ecal)});
+        }
+      }
+
+      double Etot=Etot_hcal+Etot_ecal;
+      if (Etot > 0 && Etot_hcal > 0){
+          auto rec_part = out_neutrons->create();
+          double corr=FarForwardNeutronReconstruction::calc_corr(Etot,m_cfg.scale_corr_coeff_hcal);
+          Etot_hcal=Etot_hcal/(1+corr);
+          corr=FarForwardNeutronReconstruction::calc_corr(Etot,m_cfg.scale_corr_coeff_ecal);
+          Etot_ecal=Etot_ecal/(1+corr);
+          Etot=Etot_hcal+Etot_ecal;
+          rec_part.setEnergy(Etot);
+          rec_part.setPDG(2112);
+          // Centroid weights cancel in the direction, no need to normalize
+          edm4hep::Vector3f position(wx, wy, wz);
+          double p = sqrt(Etot*Etot-m_neutron*m_neutron);
+          double r = edm4hep::utils::magnitude(position);
+          edm4hep::Vector3f momentum = position * (p / r);
+          rec_part.setMomentum(momentum);
+          rec_part.setCharge(0);
+          rec_part.setMass(m_neutron);
+          rec_part.addToClusters(*cluster_hcal);
+          if (cluster_ecal) {
+            rec_part.addToClusters(*cluster_ecal);
+          }
+      }
+
+      // Validation against the full clustering chain
+      if (reference == nullptr) {
+        return;
+      }
+      if (reference->size() != out_neutrons->size()) {
+        debug("Found {} neutron candidates, reference has {}", out_neutrons->size(), reference->size());
+      }
+      for (const auto& fast : *out_neutrons) {
+        // Compare to the reference candidate closest in direction
+        const auto& p_fast = fast.getMomentum();
+        double min_angle = M_PI + 1;
+        std::optional<edm4eic::ReconstructedParticle> full;
+        for (const auto& candidate : *reference) {
+          const auto& p_full = candidate.getMomentum();
+          const double norm = edm4hep::utils::magnitude(p_fast) * edm4hep::utils::magnitude(p_full);
+          if (norm <= 0) {
+            continue;
+          }
+          const double cos_angle = (p_fast.x * p_full.x + p_fast.y * p_full.y + p_fast.z * p_full.z) / norm;
+          const double angle = std::acos(std::clamp(cos_angle, -1.0, 1.0));
+          if (angle < min_angle) {
+            min_angle = angle;
+            full = candidate;
+          }
+        }
+        if (!full) {
+          warning("Neutron candidate with energy {} has no reference candidate", fast.getEnergy());
+          continue;
+        }
+        const double dE = (fast.getEnergy() - full->getEnergy()) / full->getEnergy();
+        if (std::abs(dE) > m_cfg.validation_tolerance) {
+          warning("Neutron candidate energy {} differs from reference {} (dE/E = {}, angle = {})",
+                  fast.getEnergy(), full->getEnergy(), dE, min_angle);
+        } else {
+          debug("Neutron candidate dE/E = {}, angle = {}", dE, min_angle);
+        }
+      }
+    }
+}
@@ -0,0 +1,47 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2024 Sebouh Paul, EICrecon Authors
+
+#pragma once
+
+#include <algorithms/algorithm.h>
+#include <edm4eic/CalorimeterHitCollection.h>
+#include <edm4eic/ClusterCollection.h>
+#include <edm4eic/ReconstructedParticleCollection.h>
+#include <optional>
+#include <string>                                 // for basic_string
+#include <string_view>                            // for string_view
+
+#include "algorithms/interfaces/WithPodConfig.h"
+#include "algorithms/reco/FarForwardNeutronReconstructionConfig.h"
+
+namespace eicrecon {
+
+using FarForwardNeutronFastReconstructionAlgorithm = algorithms::Algorithm<
+   algorithms::Input<
+       const edm4eic::CalorimeterHitCollection,
+       std::optional<edm4eic::CalorimeterHitCollection>,
+       std::optional<edm4eic::ReconstructedParticleCollection>
+    >,
+    algorithms::Output<
+       edm4eic::ReconstructedParticleCollection,
+       edm4eic::ClusterCollection
+    >
+    >;
+    class FarForwardNeutronFastReconstruction :
+       public FarForwardNeutronFastReconstructionAlgorithm,
+       public WithPodConfig<FarForwardNeutronReconstructionConfig> {
+       public:
+         FarForwardNeutronFastReconstruction(std::string_view name)
+                  : FarForwardNeutronFastReconstructionAlgorithm{name,
+                                        {"inputHitsHcal", "inputHitsEcal", "referenceNeutrons"},
+                                        {"outputNeutrons", "outputClusters"},
+                                        "Builds a neutron candidate directly from HCAL (and optionally ECAL) hits, "
+                                        "skipping clustering; optionally compares to a reference candidate"} {}
+
+         void init() final;
+         void process(const Input&, const Output&) const final;
+    private:
+        double m_neutron{0.93956542052};
+
+    };
+} // namespace eicrecon
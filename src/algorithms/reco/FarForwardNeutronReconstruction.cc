@@ -37,7 +37,7 @@ namespace eicrecon {
       }
     }
     /** calculates the correction for a given uncorrected total energy and a set of coefficients*/
-    double FarForwardNeutronReconstruction::calc_corr(double Etot, const std::vector<double>& coeffs) const{
+    double FarForwardNeutronReconstruction::calc_corr(double Etot, const std::vector<double>& coeffs) {
       return coeffs[0]+coeffs[1]/sqrt(Etot)+coeffs[2]/Etot;
     }
     void FarForwardNeutronReconstruction::process(const FarForwardNeutronReconstruction::Input& input,
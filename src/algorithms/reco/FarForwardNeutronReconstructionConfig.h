@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <vector>
+
 namespace eicrecon {
 
   struct FarForwardNeutronReconstructionConfig {
@@ -10,6 +12,14 @@ namespace eicrecon {
     std::vector<double>      scale_corr_coeff_hcal={-0.0756, -1.91, 2.30};
     /** Correction factors for the (optional) Ecal */
     std::vector<double>      scale_corr_coeff_ecal={-0.352, -1.34, 1.61};
+
+    /** Sampling fraction of the Hcal hits in the hit-level fast path (FarForwardNeutronFastReconstruction),
+        the rec hits are not corrected for it, same as in the HcalFarForwardZDCClusters */
+    double                   hcal_sampling_fraction=0.0203;
+    /** Minimum hit energy in the hit-level fast path, before the sampling fraction correction */
+    double                   min_hit_energy=0;
+    /** Relative energy difference to the reference candidate above which the fast path warns */
+    double                   validation_tolerance=0.05;
   };
 
 } // eicrecon
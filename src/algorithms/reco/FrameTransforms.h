@@ -0,0 +1,64 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2024 EICrecon Authors
+
+#pragma once
+
+#include <Math/LorentzRotation.h>
+#include <Math/Vector4D.h>
+#include <edm4eic/ReconstructedParticleCollection.h>
+#include <stddef.h>
+#include <array>
+#include <vector>
+
+namespace eicrecon {
+
+  /// Per-event Lorentz transforms from the lab frame to the frames used in the
+  /// reconstruction, see FrameTransformsBuilder. The colinear frame boost is
+  /// BeamContext::boost.
+  struct FrameTransforms {
+    /// Lab to Breit frame, with the virtual photon along -z
+    ROOT::Math::LorentzRotation breit;
+
+    bool has_breit{false};
+  };
+
+  /// Four-momenta stored component by component, so that a transform can be
+  /// applied to all of them in one vectorizable loop
+  struct FourMomenta {
+    std::vector<double> px, py, pz, e;
+
+    size_t size() const { return e.size(); }
+
+    void assign(const edm4eic::ReconstructedParticleCollection& parts) {
+      const size_t n = parts.size();
+      px.resize(n); py.resize(n); pz.resize(n); e.resize(n);
+      for (size_t i = 0; i < n; ++i) {
+        const auto p = parts[i];
+        px[i] = p.getMomentum().x;
+        py[i] = p.getMomentum().y;
+        pz[i] = p.getMomentum().z;
+        e[i] = p.getEnergy();
+      }
+    }
+  };
+
+  /// Apply tf to all four-momenta in place
+  inline void apply_transform(const ROOT::Math::LorentzRotation& tf, FourMomenta& p) {
+    // Row-major xx, xy, xz, xt, yx, ..., tt
+    std::array<double, 16> m;
+    tf.GetComponents(m.begin());
+    double* px = p.px.data();
+    double* py = p.py.data();
+    double* pz = p.pz.data();
+    double* e = p.e.data();
+    const size_t n = p.size();
+    for (size_t i = 0; i < n; ++i) {
+      const double x = px[i], y = py[i], z = pz[i], t = e[i];
+      px[i] = m[0]  * x + m[1]  * y + m[2]  * z + m[3]  * t;
+      py[i] = m[4]  * x + m[5]  * y + m[6]  * z + m[7]  * t;
+      pz[i] = m[8]  * x + m[9]  * y + m[10] * z + m[11] * t;
+      e[i]  = m[12] * x + m[13] * y + m[14] * z + m[15] * t;
+    }
+  }
+
+} // namespace eicrecon
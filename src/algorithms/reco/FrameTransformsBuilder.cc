@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2024 EICrecon Authors
+
+#include "FrameTransformsBuilder.h"
+
+#include <Math/GenVector/Boost.h>
+#include <Math/GenVector/Rotation3D.h>
+#include <edm4hep/utils/kinematics.h>
+#include <gsl/pointers>
+
+namespace eicrecon {
+
+  void FrameTransformsBuilder::init() { }
+
+  void FrameTransformsBuilder::process(
+      const FrameTransformsBuilder::Input& input,
+      const FrameTransformsBuilder::Output& output) const {
+
+    const auto [context, kine] = input;
+    auto [transforms] = output;
+
+    *transforms = FrameTransforms{};
+
+    if (!context->hasBeams()) {
+      debug("No beams found");
+      return;
+    }
+    const auto& e_initial = context->ei;
+    const auto& p_initial = context->pi;
+    debug("electron energy, proton energy = {},{}", e_initial.E(), p_initial.E());
+
+    // Get the event kinematics, set up the Breit frame transform
+    if (kine->size() == 0) {
+      debug("No kinematics found");
+      return;
+    }
+    const auto& evt_kin = kine->at(0);
+    const auto meas_x = evt_kin.getX();
+    debug("x, Q^2 = {},{}", meas_x, evt_kin.getQ2());
+
+    // Use relation to get reconstructed scattered electron
+    const ROOT::Math::PxPyPzEVector e_final = edm4hep::utils::detail::p4(evt_kin.getScat(), &edm4hep::utils::UseEnergy);
+    const ROOT::Math::PxPyPzEVector virtual_photon = (e_initial - e_final);
+
+    // Boost to the Breit frame
+    const auto P3 = p_initial.Vect();
+    const auto q3 = virtual_photon.Vect();
+    const ROOT::Math::Boost breit(-(2.0*meas_x*P3 + q3)*(1.0/(2.0*meas_x*p_initial.E() + virtual_photon.E())));
+
+    // Then rotate so the virtual photon momentum is all along the negative z-axis
+    const ROOT::Math::PxPyPzEVector e_initial_breit = breit * e_initial;
+    const ROOT::Math::PxPyPzEVector e_final_breit = breit * e_final;
+    const ROOT::Math::PxPyPzEVector virtual_photon_breit = breit * virtual_photon;
+    const auto zhat = -virtual_photon_breit.Vect().Unit();
+    const auto yhat = (e_initial_breit.Vect().Cross(e_final_breit.Vect())).Unit();
+    const auto xhat = yhat.Cross(zhat);
+    const ROOT::Math::Rotation3D breitRotInv(xhat, yhat, zhat);
+
+    transforms->breit = ROOT::Math::LorentzRotation(breitRotInv.Inverse()) * ROOT::Math::LorentzRotation(breit);
+    transforms->has_breit = true;
+
+    // Diagnostics
+    if (level() <= algorithms::LogLevel::kDebug) {
+      const ROOT::Math::PxPyPzEVector p_initial_breit = transforms->breit * p_initial;
+      const ROOT::Math::PxPyPzEVector q_breit = transforms->breit * virtual_photon;
+      debug("incoming hadron in Breit frame px,py,pz,E = {},{},{},{}",
+            p_initial_breit.Px(), p_initial_breit.Py(), p_initial_breit.Pz(), p_initial_breit.E());
+      debug("virtual photon in Breit frame px,py,pz,E = {},{},{},{}",
+            q_breit.Px(), q_breit.Py(), q_breit.Pz(), q_breit.E());
+    }
+  }
+
+} // namespace eicrecon
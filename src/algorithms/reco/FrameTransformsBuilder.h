@@ -0,0 +1,33 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2024 EICrecon Authors
+
+#pragma once
+
+#include <algorithms/algorithm.h>
+#include <edm4eic/InclusiveKinematicsCollection.h>
+#include <string>
+#include <string_view>
+
+#include "BeamContext.h"
+#include "FrameTransforms.h"
+
+namespace eicrecon {
+
+using FrameTransformsBuilderAlgorithm = algorithms::Algorithm<
+    algorithms::Input<BeamContext, edm4eic::InclusiveKinematicsCollection>,
+    algorithms::Output<FrameTransforms>>;
+
+class FrameTransformsBuilder : public FrameTransformsBuilderAlgorithm {
+
+public:
+  FrameTransformsBuilder(std::string_view name)
+      : FrameTransformsBuilderAlgorithm{name,
+                                        {"beamContext", "inputInclusiveKinematics"},
+                                        {"frameTransforms"},
+                                        "Determine the Breit frame transform once per event."} {}
+
+  void init() final;
+  void process(const Input&, const Output&) const final;
+};
+
+} // namespace eicrecon
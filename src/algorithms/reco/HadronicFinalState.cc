@@ -8,16 +8,13 @@
 #include <Math/GenVector/PxPyPzE4D.h>
 #include <Math/Vector4Dfwd.h>
 #include <edm4eic/HadronicFinalStateCollection.h>
-#include <edm4eic/MCRecoParticleAssociationCollection.h>
 #include <edm4eic/ReconstructedParticleCollection.h>
-#include <edm4hep/MCParticleCollection.h>
 #include <edm4hep/Vector3f.h>
 #include <fmt/core.h>
 #include <podio/ObjectID.h>
 #include <cmath>
 #include <gsl/pointers>
 
-#include "Beam.h"
 #include "Boost.h"
 #include "HadronicFinalState.h"
 
@@ -31,60 +28,27 @@ namespace eicrecon {
       const HadronicFinalState::Input& input,
       const HadronicFinalState::Output& output) const {
 
-    const auto [mcparts, rcparts, rcassoc] = input;
+    const auto [beam, rcparts] = input;
     auto [hadronicfinalstate] = output;
 
-    // Get incoming electron beam
-    const auto ei_coll = find_first_beam_electron(mcparts);
-    if (ei_coll.size() == 0) {
+    // Incoming beams and scattered electron are determined once per event
+    if (!beam->mc_beam_electron) {
       debug("No beam electron found");
       return;
     }
-    const PxPyPzEVector ei(
-      round_beam_four_momentum(
-        ei_coll[0].getMomentum(),
-        m_particleSvc.particle(ei_coll[0].getPDG()).mass,
-        {-5.0, -10.0, -18.0},
-        0.0)
-      );
-
-    // Get incoming hadron beam
-    const auto pi_coll = find_first_beam_hadron(mcparts);
-    if (pi_coll.size() == 0) {
+    if (!beam->mc_beam_hadron) {
       debug("No beam hadron found");
       return;
     }
-    const PxPyPzEVector pi(
-      round_beam_four_momentum(
-        pi_coll[0].getMomentum(),
-        m_particleSvc.particle(pi_coll[0].getPDG()).mass,
-        {41.0, 100.0, 275.0},
-        m_crossingAngle)
-      );
-
-    // Get first scattered electron
-    const auto ef_coll = find_first_scattered_electron(mcparts);
-    if (ef_coll.size() == 0) {
+    if (!beam->mc_scattered_electron) {
       debug("No truth scattered electron found");
       return;
     }
-    // Associate first scattered electron with reconstructed electrons
-    //const auto ef_assoc = std::find_if(
-    //  rcassoc->begin(),
-    //  rcassoc->end(),
-    //  [&ef_coll](const auto& a){ return a.getSim().getObjectID() == ef_coll[0].getObjectID(); });
-    auto ef_assoc = rcassoc->begin();
-    for (; ef_assoc != rcassoc->end(); ++ef_assoc) {
-      if (ef_assoc->getSim().getObjectID() == ef_coll[0].getObjectID()) {
-        break;
-      }
-    }
-    if (!(ef_assoc != rcassoc->end())) {
+    if (!beam->rc_scattered_electron) {
       debug("Truth scattered electron not in reconstructed particles");
       return;
     }
-    const auto ef_rc{ef_assoc->getRec()};
-    const auto ef_rc_id{ef_rc.getObjectID().index};
+    const auto ef_rc_id{beam->rc_scattered_electron->getObjectID().index};
 
     // Sums in colinear frame
     double pxsum = 0;
@@ -93,7 +57,7 @@ namespace eicrecon {
     double Esum = 0;
 
     // Get boost to colinear frame
-    auto boost = determine_boost(ei, pi);
+    const auto& boost = beam->boost;
 
     auto hfs = hadronicfinalstate->create(0., 0., 0.);
 
@@ -5,19 +5,16 @@
 
 #include <algorithms/algorithm.h>
 #include <edm4eic/HadronicFinalStateCollection.h>
-#include <edm4eic/MCRecoParticleAssociationCollection.h>
 #include <edm4eic/ReconstructedParticleCollection.h>
-#include <edm4hep/MCParticleCollection.h>
 #include <string>
 #include <string_view>
 
-#include "algorithms/interfaces/ParticleSvc.h"
+#include "BeamContext.h"
 
 namespace eicrecon {
 
 using HadronicFinalStateAlgorithm = algorithms::Algorithm<
-    algorithms::Input<edm4hep::MCParticleCollection, edm4eic::ReconstructedParticleCollection,
-                      edm4eic::MCRecoParticleAssociationCollection>,
+    algorithms::Input<BeamContext, edm4eic::ReconstructedParticleCollection>,
     algorithms::Output<edm4eic::HadronicFinalStateCollection>>;
 
 class HadronicFinalState : public HadronicFinalStateAlgorithm {
@@ -25,16 +22,12 @@ class HadronicFinalState : public HadronicFinalStateAlgorithm {
 public:
   HadronicFinalState(std::string_view name)
       : HadronicFinalStateAlgorithm{name,
-                                    {"MCParticles", "inputParticles", "inputAssociations"},
+                                    {"beamContext", "inputParticles"},
                                     {"hadronicFinalState"},
                                     "Calculate summed quantities of the hadronic final state."} {}
 
   void init() final;
   void process(const Input&, const Output&) const final;
-
-private:
-  const algorithms::ParticleSvc& m_particleSvc = algorithms::ParticleSvc::instance();
-  double m_crossingAngle{-0.025};
 };
 
 } // namespace eicrecon
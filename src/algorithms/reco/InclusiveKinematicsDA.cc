@@ -29,39 +29,23 @@ namespace eicrecon {
       const InclusiveKinematicsDA::Input& input,
       const InclusiveKinematicsDA::Output& output) const {
 
-    const auto [mcparts, escat, hfs] = input;
+    const auto [beam, escat, hfs] = input;
     auto [kinematics] = output;
 
-    // Get incoming electron beam
-    const auto ei_coll = find_first_beam_electron(mcparts);
-    if (ei_coll.size() == 0) {
+    // Get incoming beams
+    if (!beam->mc_beam_electron) {
       debug("No beam electron found");
       return;
     }
-    const PxPyPzEVector ei(
-      round_beam_four_momentum(
-        ei_coll[0].getMomentum(),
-        m_particleSvc.particle(ei_coll[0].getPDG()).mass,
-        {-5.0, -10.0, -18.0},
-        0.0)
-      );
-
-    // Get incoming hadron beam
-    const auto pi_coll = find_first_beam_hadron(mcparts);
-    if (pi_coll.size() == 0) {
+    if (!beam->mc_beam_hadron) {
       debug("No beam hadron found");
       return;
     }
-    const PxPyPzEVector pi(
-      round_beam_four_momentum(
-        pi_coll[0].getMomentum(),
-        m_particleSvc.particle(pi_coll[0].getPDG()).mass,
-        {41.0, 100.0, 275.0},
-        m_crossingAngle)
-      );
+    const PxPyPzEVector& ei = beam->ei;
+    const PxPyPzEVector& pi = beam->pi;
 
     // Get boost to colinear frame
-    auto boost = determine_boost(ei, pi);
+    const auto& boost = beam->boost;
 
     // Get electron angle
     auto kf = escat->at(0);
@@ -7,16 +7,16 @@
 #include <edm4eic/HadronicFinalStateCollection.h>
 #include <edm4eic/InclusiveKinematicsCollection.h>
 #include <edm4eic/ReconstructedParticleCollection.h>
-#include <edm4hep/MCParticleCollection.h>
 #include <string>
 #include <string_view>
 
+#include "BeamContext.h"
 #include "algorithms/interfaces/ParticleSvc.h"
 
 namespace eicrecon {
 
 using InclusiveKinematicsESigmaAlgorithm = algorithms::Algorithm<
-    algorithms::Input<edm4hep::MCParticleCollection, edm4eic::ReconstructedParticleCollection,
+    algorithms::Input<BeamContext, edm4eic::ReconstructedParticleCollection,
                       edm4eic::HadronicFinalStateCollection>,
     algorithms::Output<edm4eic::InclusiveKinematicsCollection>>;
 
@@ -26,7 +26,7 @@ public:
   InclusiveKinematicsESigma(std::string_view name)
       : InclusiveKinematicsESigmaAlgorithm{
             name,
-            {"MCParticles", "scatteredElectron", "hadronicFinalState"},
+            {"beamContext", "scatteredElectron", "hadronicFinalState"},
             {"inclusiveKinematics"},
             "Determine inclusive kinematics using e-Sigma method."} {}
 
@@ -35,7 +35,6 @@ public:
 
 private:
   const algorithms::ParticleSvc& m_particleSvc = algorithms::ParticleSvc::instance();
-  double m_crossingAngle{-0.025};
 };
 
 } // namespace eicrecon
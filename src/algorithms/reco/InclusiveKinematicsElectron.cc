@@ -29,7 +29,7 @@ namespace eicrecon {
       const InclusiveKinematicsElectron::Input& input,
       const InclusiveKinematicsElectron::Output& output) const {
 
-    const auto [mcparts, escat, hfs] = input;
+    const auto [beam, escat, hfs] = input;
     auto [kinematics] = output;
 
     // 1. find_if
@@ -80,33 +80,17 @@ namespace eicrecon {
     //  break;
     //}
 
-    // Get incoming electron beam
-    const auto ei_coll = find_first_beam_electron(mcparts);
-    if (ei_coll.size() == 0) {
+    // Get incoming beams
+    if (!beam->mc_beam_electron) {
       debug("No beam electron found");
       return;
     }
-    const PxPyPzEVector ei(
-      round_beam_four_momentum(
-        ei_coll[0].getMomentum(),
-        m_particleSvc.particle(ei_coll[0].getPDG()).mass,
-        {-5.0, -10.0, -18.0},
-        0.0)
-      );
-
-    // Get incoming hadron beam
-    const auto pi_coll = find_first_beam_hadron(mcparts);
-    if (pi_coll.size() == 0) {
+    if (!beam->mc_beam_hadron) {
       debug("No beam hadron found");
       return;
     }
-    const PxPyPzEVector pi(
-      round_beam_four_momentum(
-        pi_coll[0].getMomentum(),
-        m_particleSvc.particle(pi_coll[0].getPDG()).mass,
-        {41.0, 100.0, 275.0},
-        m_crossingAngle)
-      );
+    const PxPyPzEVector& ei = beam->ei;
+    const PxPyPzEVector& pi = beam->pi;
 
     // Get scattered electron
     std::vector<PxPyPzEVector> electrons;
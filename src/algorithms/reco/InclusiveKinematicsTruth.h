@@ -5,16 +5,16 @@
 
 #include <algorithms/algorithm.h>
 #include <edm4eic/InclusiveKinematicsCollection.h>
-#include <edm4hep/MCParticleCollection.h>
 #include <string>
 #include <string_view>
 
+#include "BeamContext.h"
 #include "algorithms/interfaces/ParticleSvc.h"
 
 namespace eicrecon {
 
 using InclusiveKinematicsTruthAlgorithm =
-    algorithms::Algorithm<algorithms::Input<edm4hep::MCParticleCollection>,
+    algorithms::Algorithm<algorithms::Input<BeamContext>,
                           algorithms::Output<edm4eic::InclusiveKinematicsCollection>>;
 
 class InclusiveKinematicsTruth : public InclusiveKinematicsTruthAlgorithm {
@@ -23,7 +23,7 @@ public:
   InclusiveKinematicsTruth(std::string_view name)
       : InclusiveKinematicsTruthAlgorithm{
             name,
-            {"MCParticles"},
+            {"beamContext"},
             {"inclusiveKinematics"},
             "Determine inclusive kinematics from truth information."} {}
 
@@ -32,7 +32,6 @@ public:
 
 private:
   const algorithms::ParticleSvc& m_particleSvc = algorithms::ParticleSvc::instance();
-  double m_crossingAngle{-0.025};
 };
 
 } // namespace eicrecon
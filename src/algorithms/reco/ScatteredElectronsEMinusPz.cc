@@ -8,9 +8,11 @@
 #include <edm4hep/Vector3f.h>
 #include <fmt/core.h>
 #include <podio/ObjectID.h>
-#include <iterator>
-#include <map>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <utility>
+#include <vector>
 
 #include "algorithms/reco/ScatteredElectronsEMinusPz.h"
 #include "algorithms/reco/ScatteredElectronsEMinusPzConfig.h"
@@ -41,11 +43,6 @@ namespace eicrecon {
                 const edm4eic::ReconstructedParticleCollection *rcele
         ){
 
-    // this map will store intermediate results
-    // so that we can sort them before filling output
-    // collection
-    std::map<double, edm4eic::ReconstructedParticle> scatteredElectronsMap;
-
     // our output collection of scattered electrons
     // ordered by E-Pz
     auto out_electrons =  std::make_unique<
@@ -57,47 +54,69 @@ namespace eicrecon {
         rcele->size()
       );
 
+    // Candidates sorted by ObjectID, so that we can find
+    // them while summing the reconstructed particles
+    auto key = [](const podio::ObjectID& id) {
+      return (static_cast<std::uint64_t>(id.collectionID) << 32) | static_cast<std::uint32_t>(id.index);
+    };
+    std::vector<std::pair<std::uint64_t, std::size_t>> candidateIDs;
+    candidateIDs.reserve(rcele->size());
+    for (std::size_t i = 0; i < rcele->size(); ++i) {
+      candidateIDs.emplace_back(key((*rcele)[i].getObjectID()), i);
+    }
+    std::sort(candidateIDs.begin(), candidateIDs.end());
+
     // Lorentz Vector for the scattered electron,
     // hadronic final state, and individual hadron
     // We do it here to avoid creating objects inside the loops
-    PxPyPzMVector  vScatteredElectron;
-    PxPyPzMVector  vHadronicFinalState;
+    PxPyPzEVector  vScatteredElectron;
+    PxPyPzEVector  vTotal;
     PxPyPzMVector  vHadron;
 
-    for ( const auto& e: *rcele ) {
-      // Do not cut on charge to account for charge-symmetric background
+    // Contribution of each candidate to the total, if it
+    // is itself among the reconstructed particles
+    std::vector<PxPyPzEVector> vCandidateAsHadron(rcele->size());
+
+    // Single loop over reconstructed particles to sum
+    // everything, assuming pions for the hadronic state
+    for (const auto& p: *rcparts) {
+      vHadron.SetCoordinates(
+          p.getMomentum().x,
+          p.getMomentum().y,
+          p.getMomentum().z,
+          m_pion // Assume pion for hadronic state
+        );
+      vTotal += vHadron;
+
+      const auto id = key(p.getObjectID());
+      auto range = std::equal_range(candidateIDs.begin(), candidateIDs.end(), std::make_pair(id, std::size_t{0}),
+                                    [](const auto& a, const auto& b) { return a.first < b.first; });
+      for (auto it = range.first; it != range.second; ++it) {
+        vCandidateAsHadron[it->second] = PxPyPzEVector(vHadron);
+      }
+    } // hadron loop (reconstructed particles)
+
+    // E-Pz for each candidate, to be sorted before
+    // filling the output collection
+    std::vector<std::pair<double, edm4eic::ReconstructedParticle>> scatteredElectrons;
+    scatteredElectrons.reserve(rcele->size());
 
-      // reset the HadronicFinalState
-      vHadronicFinalState.SetCoordinates(0, 0, 0, 0);
+    for (std::size_t i = 0; i < rcele->size(); ++i) {
+      const auto e = (*rcele)[i];
+      // Do not cut on charge to account for charge-symmetric background
 
       // Set a vector for the electron we are considering now
-      vScatteredElectron.SetCoordinates(
+      vScatteredElectron = PxPyPzEVector(PxPyPzMVector(
           e.getMomentum().x,
           e.getMomentum().y,
           e.getMomentum().z,
           m_electron
-        );
+        ));
 
-      // Loop over reconstructed particles to
-      // sum hadronic final state
-      for (const auto& p: *rcparts) {
-        // What we want is to add all reconstructed particles
-        // except the one we are currently considering as the
-        // (scattered) electron candidate.
-        if (p.getObjectID() != e.getObjectID()) {
-          vHadron.SetCoordinates(
-              p.getMomentum().x,
-              p.getMomentum().y,
-              p.getMomentum().z,
-              m_pion // Assume pion for hadronic state
-            );
-
-          // Sum hadronic final state
-          vHadronicFinalState += vHadron;
-        } else {
-          m_log->trace( "Skipping electron in hadronic final state" );
-        }
-      } // hadron loop (reconstructed particles)
+      // What we want is to add all reconstructed particles
+      // except the one we are currently considering as the
+      // (scattered) electron candidate.
+      const auto vHadronicFinalState = vTotal - vCandidateAsHadron[i];
 
       // Calculate the E-Pz for this electron
       // + hadron final state combination
@@ -109,18 +128,18 @@ namespace eicrecon {
       m_log->trace( "\tScatteredElectron has Pxyz=( {}, {}, {} )", e.getMomentum().x, e.getMomentum().y, e.getMomentum().z );
 
       // Store the result of this calculation
-      scatteredElectronsMap[ EPz ] = e;
+      scatteredElectrons.emplace_back( EPz, e );
     } // electron loop
 
+    // sort by descending E-Pz
+    std::stable_sort(scatteredElectrons.begin(), scatteredElectrons.end(),
+                     [](const auto& a, const auto& b) { return a.first > b.first; });
+
     m_log->trace( "Selecting candidates with {} < E-Pz < {}", m_cfg.minEMinusPz, m_cfg.maxEMinusPz );
 
-    // map sorts in descending order by default
-    // sort by descending
     bool first = true;
-    // for (auto kv : scatteredElectronsMap) {
-    for (auto kv = scatteredElectronsMap.rbegin(); kv != scatteredElectronsMap.rend(); ++kv) {
+    for (const auto& [EMinusPz, electron] : scatteredElectrons) {
 
-      double EMinusPz = kv->first;
       // Do not save electron candidates that
       // are not within range
       if ( EMinusPz > m_cfg.maxEMinusPz
@@ -133,11 +152,11 @@ namespace eicrecon {
       if ( first ){
         m_log->trace( "Max E-Pz Candidate:" );
         m_log->trace( "\tE-Pz={}", EMinusPz );
-        m_log->trace( "\tScatteredElectron has Pxyz=( {}, {}, {} )", kv->second.getMomentum().x, kv->second.getMomentum().y, kv->second.getMomentum().z );
+        m_log->trace( "\tScatteredElectron has Pxyz=( {}, {}, {} )", electron.getMomentum().x, electron.getMomentum().y, electron.getMomentum().z );
         first = false;
       }
-      out_electrons->push_back( kv->second );
-    } // reverse loop on scatteredElectronsMap
+      out_electrons->push_back( electron );
+    } // loop on sorted scatteredElectrons
 
 
     // Return Electron candidates ranked
@@ -4,20 +4,17 @@
 #pragma once
 
 #include <algorithms/algorithm.h>
-#include <edm4eic/InclusiveKinematicsCollection.h>
 #include <edm4eic/ReconstructedParticleCollection.h>
-#include <edm4hep/MCParticleCollection.h>
 #include <string>
 #include <string_view>
 
-#include "algorithms/interfaces/ParticleSvc.h"
+#include "FrameTransforms.h"
 #include "algorithms/interfaces/WithPodConfig.h"
 
 namespace eicrecon {
 
 using TransformBreitFrameAlgorithm = algorithms::Algorithm<
-    algorithms::Input<edm4hep::MCParticleCollection, edm4eic::InclusiveKinematicsCollection,
-                      edm4eic::ReconstructedParticleCollection>,
+    algorithms::Input<FrameTransforms, edm4eic::ReconstructedParticleCollection>,
     algorithms::Output<edm4eic::ReconstructedParticleCollection>>;
 
 class TransformBreitFrame : public TransformBreitFrameAlgorithm, public WithPodConfig<NoConfig> {
@@ -26,7 +23,7 @@ public:
   TransformBreitFrame(std::string_view name)
       : TransformBreitFrameAlgorithm{
             name,
-            {"inputMCParticles", "inputInclusiveKinematics", "inputReconstructedParticles"},
+            {"frameTransforms", "inputReconstructedParticles"},
             {"outputReconstructedParticles"},
             "Transforms a set of particles from the lab frame to the Breit frame"} {}
 
@@ -36,10 +33,6 @@ public:
   // run algorithm
   void process(const Input&, const Output&) const final;
 
-private:
-  const algorithms::ParticleSvc& m_particleSvc = algorithms::ParticleSvc::instance();
-  double m_crossingAngle{-0.025};
-
 }; // end TransformBreitFrame definition
 
 } // namespace eicrecon
@@ -150,7 +150,8 @@ void ActsGeometryProvider::initialize(const dd4hep::Detector* dd4hep_geo,
         }
 
         m_init_log->debug("visiting all the surfaces  ");
-        m_trackingGeo->visitSurfaces([this](const Acts::Surface *surface) {
+        auto volman = m_dd4hepDetector->volumeManager();
+        m_trackingGeo->visitSurfaces([this, &volman](const Acts::Surface *surface) {
             // for now we just require a valid surface
             if (surface == nullptr) {
                 m_init_log->info("no surface??? ");
@@ -166,11 +167,15 @@ void ActsGeometryProvider::initialize(const dd4hep::Detector* dd4hep_geo,
 
             // more verbose output is lower enum value
             m_init_log->debug(" det_element->identifier() = {} ", det_element->identifier());
-            auto volman = m_dd4hepDetector->volumeManager();
-            auto *vol_ctx = volman.lookupContext(det_element->identifier());
-            auto vol_id = vol_ctx->identifier;
+            // The identifier of a DD4hep detector element is already the volume ID
+            // of its placement, the volume manager is only needed for diagnostics
+            const uint64_t vol_id = det_element->identifier();
 
             if (m_init_log->level() <= spdlog::level::debug) {
+                auto *vol_ctx = volman.lookupContext(vol_id);
+                if (vol_ctx->identifier != vol_id) {
+                    m_init_log->warn("  volume manager identifier {} differs from {}", vol_ctx->identifier, vol_id);
+                }
                 auto de = vol_ctx->element;
                 m_init_log->debug("  de.path          = {}", de.path());
                 m_init_log->debug("  de.placementPath = {}", de.placementPath());
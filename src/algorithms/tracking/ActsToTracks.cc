@@ -19,14 +19,16 @@
 #include <podio/ObjectID.h>
 #include <podio/RelationRange.h>
 #include <Eigen/Core>
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <gsl/pointers>
-#include <map>
 #include <numeric>
 #include <optional>
 #include <utility>
+#include <vector>
 
 #include "ActsToTracks.h"
 
@@ -47,6 +49,12 @@ static constexpr std::array<std::pair<Acts::BoundIndices, double>, 6> edm4eic_in
   {Acts::eBoundTime, Acts::UnitConstants::ns}
 }};
 
+// Key a podio object by its collection ID and index within that collection
+static inline std::uint64_t object_key(const podio::ObjectID& id) {
+  return (static_cast<std::uint64_t>(id.collectionID) << 32)
+       | static_cast<std::uint32_t>(id.index);
+}
+
 void ActsToTracks::init() {
 }
 
@@ -54,6 +62,22 @@ void ActsToTracks::process(const Input& input, const Output& output) const {
   const auto [meas2Ds, acts_trajectories, raw_hit_assocs] = input;
   auto  [trajectories, track_parameters, tracks, tracks_assoc] = output;
 
+  // Index the raw hit associations by raw hit once per event, sorted by key,
+  // so that each measurement lookup is a binary search instead of a scan
+  // over all associations
+  std::vector<std::pair<std::uint64_t, std::size_t>> raw_hit_assoc_index;
+  #if EDM4EIC_VERSION_MAJOR >= 7
+    raw_hit_assoc_index.reserve(raw_hit_assocs->size());
+    for (std::size_t i = 0; i < raw_hit_assocs->size(); ++i) {
+      raw_hit_assoc_index.emplace_back(object_key((*raw_hit_assocs)[i].getRawHit().getObjectID()), i);
+    }
+    std::sort(raw_hit_assoc_index.begin(), raw_hit_assoc_index.end());
+  #endif
+
+  // Per-track MCParticle weight accumulator, reused across tracks; a track
+  // has only a handful of contributing particles so a linear scan is cheapest
+  std::vector<std::pair<edm4hep::MCParticle,double>> mcparticle_weight_by_hit_count;
+
   // Loop over trajectories
   for (const auto traj : acts_trajectories) {
     // The trajectory entry indices and the multiTrajectory
@@ -157,7 +181,7 @@ void ActsToTracks::process(const Input& input, const Output& output) const {
       track.setTrajectory(trajectory);           // Trajectory of this track
 
       // Determine track association with MCParticle, weighted by number of used measurements
-      std::map<edm4hep::MCParticle,double> mcparticle_weight_by_hit_count;
+      mcparticle_weight_by_hit_count.clear();
 
       // save measurement2d to good measurements or outliers according to srclink index
       // fix me: ideally, this should be integrated into multitrajectoryhelper
@@ -190,12 +214,19 @@ void ActsToTracks::process(const Input& input, const Output& output) const {
                     //if (raw_hit_assocs->has_value()) {
                     #if EDM4EIC_VERSION_MAJOR >= 7
                       for (auto& hit : meas2D.getHits()) {
-                        auto raw_hit = hit.getRawHit();
-                        for (const auto raw_hit_assoc : *raw_hit_assocs) {
-                          if (raw_hit_assoc.getRawHit() == raw_hit) {
-                            auto sim_hit = raw_hit_assoc.getSimHit();
-                            auto mc_particle = sim_hit.getMCParticle();
-                            mcparticle_weight_by_hit_count[mc_particle]++;
+                        const std::uint64_t key = object_key(hit.getRawHit().getObjectID());
+                        auto it = std::lower_bound(
+                          raw_hit_assoc_index.begin(), raw_hit_assoc_index.end(),
+                          std::make_pair(key, std::size_t{0}));
+                        for (; it != raw_hit_assoc_index.end() && it->first == key; ++it) {
+                          auto mc_particle = (*raw_hit_assocs)[it->second].getSimHit().getMCParticle();
+                          auto weight_it = std::find_if(
+                            mcparticle_weight_by_hit_count.begin(), mcparticle_weight_by_hit_count.end(),
+                            [&](const auto& p) { return p.first == mc_particle; });
+                          if (weight_it == mcparticle_weight_by_hit_count.end()) {
+                            mcparticle_weight_by_hit_count.emplace_back(mc_particle, 1.);
+                          } else {
+                            weight_it->second++;
                           }
                         }
                       }
@@ -219,7 +250,7 @@ void ActsToTracks::process(const Input& input, const Output& output) const {
       //if (raw_hit_assocs->has_value()) {
         double total_weight = std::accumulate(
           mcparticle_weight_by_hit_count.begin(), mcparticle_weight_by_hit_count.end(),
-          0, [](const double sum, const auto& i) { return sum + i.second; });
+          0., [](const double sum, const auto& i) { return sum + i.second; });
         for (const auto& [mcparticle, weight] : mcparticle_weight_by_hit_count) {
           auto track_assoc = tracks_assoc->create();
           track_assoc.setRec(track);
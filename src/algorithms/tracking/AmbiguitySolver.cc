@@ -23,6 +23,7 @@
 #include <cstddef>
 #include <functional>
 #include <utility>
+#include <vector>
 
 #include "Acts/Utilities/Logger.hpp"
 #include "AmbiguitySolverConfig.h"
@@ -80,6 +81,8 @@ AmbiguitySolver::process(std::vector<const ActsExamples::ConstTrackContainer*> i
                                             std::make_shared<Acts::VectorMultiTrajectory>()};
   solvedTracks.ensureDynamicColumns(*input_trks);
 
+  // Only the track summaries are copied, the track states stay in the
+  // input multi-trajectory which is shared with the output container
   for (auto iTrack : state.selectedTracks) {
 
         auto destProxy = solvedTracks.getTrack(solvedTracks.addTrack());
@@ -94,24 +97,41 @@ AmbiguitySolver::process(std::vector<const ActsExamples::ConstTrackContainer*> i
         input_trks->trackStateContainerHolder()));
 
    //Make output trajectories
-   ActsExamples::Trajectories::IndexedParameters parameters;
-   std::vector<Acts::MultiTrajectoryTraits::IndexType> tips;
-
-   for (const auto& track : *(output_tracks.front())) {
-
-        tips.clear();
-        parameters.clear();
-
-        tips.push_back(track.tipIndex());
-        parameters.emplace(
-           std::pair{track.tipIndex(),
-                    ActsExamples::TrackParameters{track.referenceSurface().getSharedPtr(),
-                                                  track.parameters(), track.covariance(),
-                                                  track.particleHypothesis()}});
-
-        output_trajectories.push_back(new ActsExamples::Trajectories(
-             ((*output_tracks.front())).trackStateContainer(),
-             tips, parameters));
+   const auto& output_trks = *(output_tracks.front());
+   auto make_parameters = [](const auto& track) {
+     return std::pair{track.tipIndex(),
+                      ActsExamples::TrackParameters{track.referenceSurface().getSharedPtr(),
+                                                    track.parameters(), track.covariance(),
+                                                    track.particleHypothesis()}};
+   };
+
+   if (m_cfg.merge_trajectories) {
+
+        // A single trajectory holding every resolved tip
+        std::vector<Acts::MultiTrajectoryTraits::IndexType> tips;
+        ActsExamples::Trajectories::IndexedParameters parameters;
+        tips.reserve(output_trks.size());
+        for (const auto& track : output_trks) {
+          tips.push_back(track.tipIndex());
+          parameters.emplace(make_parameters(track));
+        }
+        if (!tips.empty()) {
+          output_trajectories.push_back(new ActsExamples::Trajectories(
+               output_trks.trackStateContainer(), tips, parameters));
+        }
+
+   } else {
+
+        // One trajectory per track, as expected by TrackPropagation
+        output_trajectories.reserve(output_trks.size());
+        for (const auto& track : output_trks) {
+          ActsExamples::Trajectories::IndexedParameters parameters;
+          parameters.emplace(make_parameters(track));
+          output_trajectories.push_back(new ActsExamples::Trajectories(
+               output_trks.trackStateContainer(),
+               std::vector<Acts::MultiTrajectoryTraits::IndexType>{track.tipIndex()},
+               parameters));
+        }
 
    }
 
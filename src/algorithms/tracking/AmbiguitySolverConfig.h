@@ -13,5 +13,9 @@ struct AmbiguitySolverConfig {
   std::uint32_t maximum_iterations = 100000;
   /// Minimum number of measurement to form a track.
   std::size_t n_measurements_min = 3;
+  /// Emit all resolved tracks as a single trajectory that shares the input
+  /// multi-trajectory, rather than one trajectory per track. Only suitable
+  /// for consumers that iterate over all tips (e.g. ActsToTracks).
+  bool merge_trajectories = false;
 };
 } // namespace eicrecon
@@ -54,26 +54,8 @@
 
 #include "extensions/spdlog/SpdlogToActs.h"
 
-void eicrecon::IterativeVertexFinder::init(std::shared_ptr<const ActsGeometryProvider> geo_svc,
-                                           std::shared_ptr<spdlog::logger> log) {
-
-  m_log = log;
-
-  m_geoSvc = geo_svc;
-
-  m_BField =
-      std::dynamic_pointer_cast<const eicrecon::BField::DD4hepBField>(m_geoSvc->getFieldProvider());
-  m_fieldctx = eicrecon::BField::BFieldVariant(m_BField);
-}
-
-std::unique_ptr<edm4eic::VertexCollection> eicrecon::IterativeVertexFinder::produce(
-    std::vector<const ActsExamples::Trajectories*> trajectories,
-    const edm4eic::ReconstructedParticleCollection* reconParticles) {
-
-  auto outputVertices = std::make_unique<edm4eic::VertexCollection>();
-
+struct eicrecon::IterativeVertexFinder::Vertexing {
   using Propagator        = Acts::Propagator<Acts::EigenStepper<>>;
-  using PropagatorOptions = Acts::PropagatorOptions<>;
 #if Acts_VERSION_MAJOR >= 33
   using Linearizer        = Acts::HelicalTrackLinearizer;
   using VertexFitter      = Acts::FullBilloirVertexFitter;
@@ -90,8 +72,39 @@ std::unique_ptr<edm4eic::VertexCollection> eicrecon::IterativeVertexFinder::prod
   using VertexFinderOptions  = Acts::VertexingOptions<Acts::BoundTrackParameters>;
 #endif
 
+  std::shared_ptr<Propagator> propagator;
+  // Referenced by the seeder configuration, so it has to outlive the finder
+  std::unique_ptr<ImpactPointEstimator> ipEst;
+#if Acts_VERSION_MAJOR >= 33
+  // The fitter and finder hold delegates bound to this instance
+  std::unique_ptr<Linearizer> linearizer;
+  decltype(VertexFinder::Config::extractParameters) extractParameters;
+#endif
+  std::unique_ptr<VertexFinder> finder;
+};
+
+void eicrecon::IterativeVertexFinder::init(std::shared_ptr<const ActsGeometryProvider> geo_svc,
+                                           std::shared_ptr<spdlog::logger> log) {
+
+  m_log = log;
+
+  m_geoSvc = geo_svc;
+
+  m_BField =
+      std::dynamic_pointer_cast<const eicrecon::BField::DD4hepBField>(m_geoSvc->getFieldProvider());
+  m_fieldctx = eicrecon::BField::BFieldVariant(m_BField);
+
+  using Propagator           = Vertexing::Propagator;
+  using Linearizer           = Vertexing::Linearizer;
+  using VertexFitter         = Vertexing::VertexFitter;
+  using ImpactPointEstimator = Vertexing::ImpactPointEstimator;
+  using VertexSeeder         = Vertexing::VertexSeeder;
+  using VertexFinder         = Vertexing::VertexFinder;
+
   ACTS_LOCAL_LOGGER(eicrecon::getSpdlogLogger("IVF", m_log));
 
+  auto vertexing = std::make_shared<Vertexing>();
+
   Acts::EigenStepper<> stepper(m_BField);
 
   // Set up propagator with void navigator
@@ -102,17 +115,19 @@ std::unique_ptr<edm4eic::VertexCollection> eicrecon::IterativeVertexFinder::prod
   auto propagator = std::make_shared<Propagator>(
     stepper, Acts::detail::VoidNavigator{}, logger().cloneWithSuffix("Prop"));
 #endif
-  Acts::PropagatorOptions opts(m_geoctx, m_fieldctx);
+  vertexing->propagator = propagator;
 
   // Setup the track linearizer
 #if Acts_VERSION_MAJOR >= 33
   Linearizer::Config linearizerCfg;
   linearizerCfg.bField = m_BField;
   linearizerCfg.propagator = propagator;
+  vertexing->linearizer = std::make_unique<Linearizer>(linearizerCfg, logger().cloneWithSuffix("HelLin"));
+  Linearizer& linearizer = *vertexing->linearizer;
 #else
   Linearizer::Config linearizerCfg(m_BField, propagator);
-#endif
   Linearizer linearizer(linearizerCfg, logger().cloneWithSuffix("HelLin"));
+#endif
 
   // Setup the vertex fitter
   VertexFitter::Config vertexFitterCfg;
@@ -126,7 +141,8 @@ std::unique_ptr<edm4eic::VertexCollection> eicrecon::IterativeVertexFinder::prod
 
   // Setup the seed finder
   ImpactPointEstimator::Config ipEstCfg(m_BField, propagator);
-  ImpactPointEstimator ipEst(ipEstCfg);
+  vertexing->ipEst = std::make_unique<ImpactPointEstimator>(ipEstCfg);
+  ImpactPointEstimator& ipEst = *vertexing->ipEst;
   VertexSeeder::Config seederCfg(ipEst);
 #if Acts_VERSION_MAJOR >= 33
   seederCfg.extractParameters
@@ -150,6 +166,7 @@ std::unique_ptr<edm4eic::VertexCollection> eicrecon::IterativeVertexFinder::prod
  #if Acts_VERSION_MAJOR >= 33
   finderCfg.extractParameters.connect<&Acts::InputTrack::extractParameters>();
   finderCfg.trackLinearizer.connect<&Linearizer::linearizeTrack>(&linearizer);
+  vertexing->extractParameters = finderCfg.extractParameters;
   #if Acts_VERSION_MAJOR >= 36
   finderCfg.field = m_BField;
   #else
@@ -157,10 +174,26 @@ std::unique_ptr<edm4eic::VertexCollection> eicrecon::IterativeVertexFinder::prod
     std::const_pointer_cast<eicrecon::BField::DD4hepBField>(m_BField));
   #endif
  #endif
-  VertexFinder finder(std::move(finderCfg));
+  vertexing->finder = std::make_unique<VertexFinder>(std::move(finderCfg));
 #else
-  VertexFinder finder(finderCfg);
+  vertexing->finder = std::make_unique<VertexFinder>(finderCfg);
 #endif
+
+  m_vertexing = std::move(vertexing);
+}
+
+std::unique_ptr<edm4eic::VertexCollection> eicrecon::IterativeVertexFinder::produce(
+    std::vector<const ActsExamples::Trajectories*> trajectories,
+    const edm4eic::ReconstructedParticleCollection* reconParticles) {
+
+  auto outputVertices = std::make_unique<edm4eic::VertexCollection>();
+
+  using VertexFinder        = Vertexing::VertexFinder;
+  using VertexFinderOptions = Vertexing::VertexFinderOptions;
+  const VertexFinder& finder = *m_vertexing->finder;
+
+  // Only the per-event finder state (field and impact point caches) is
+  // created here, the vertexing chain itself is reused from init()
 #if Acts_VERSION_MAJOR >= 33
   Acts::IVertexFinder::State state(
     std::in_place_type<VertexFinder::State>,
@@ -226,7 +259,7 @@ std::unique_ptr<edm4eic::VertexCollection> eicrecon::IterativeVertexFinder::prod
     for (const auto& t : vtx.tracks()) {
 #if Acts_VERSION_MAJOR >= 33
       const auto& trk = &t.originalParams;
-      const auto& par = finderCfg.extractParameters(trk);
+      const auto& par = m_vertexing->extractParameters(trk);
 #else
       const auto& par = *t.originalParams;
 #endif
@@ -28,6 +28,11 @@ public:
   produce(std::vector<const ActsExamples::Trajectories*> trajectories, const edm4eic::ReconstructedParticleCollection* reconParticles);
 
 private:
+  /// ACTS vertexing chain (propagator, linearizer, fitter, seeder, finder),
+  /// built once in init() and reused for every event
+  struct Vertexing;
+  std::shared_ptr<const Vertexing> m_vertexing;
+
   std::shared_ptr<spdlog::logger> m_log;
   std::shared_ptr<const ActsGeometryProvider> m_geoSvc;
 
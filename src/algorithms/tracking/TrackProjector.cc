@@ -1,7 +1,9 @@
 // SPDX-License-Identifier: LGPL-3.0-or-later
 // Copyright (C) 2022 wfan, Whitney Armstrong, Sylvester Joosten
 
+#include <Acts/Definitions/Algebra.hpp>
 #include <Acts/Definitions/TrackParametrization.hpp>
+#include <Acts/EventData/MultiTrajectory.hpp>
 #include <Acts/EventData/MultiTrajectoryHelpers.hpp>
 #include <Acts/Geometry/GeometryIdentifier.hpp>
 #include <Acts/Utilities/UnitVectors.hpp>
@@ -17,6 +19,7 @@
 #include <fmt/ostream.h>
 #include <spdlog/logger.h>
 #include <stdint.h>
+#include <algorithm>
 #include <cmath>
 #include <iterator>
 #include <utility>
@@ -34,6 +37,9 @@ namespace eicrecon {
     TrackProjector::init(std::shared_ptr<const ActsGeometryProvider> geo_svc, std::shared_ptr<spdlog::logger> logger) {
         m_log = logger;
         m_geo_provider = geo_svc;
+
+        m_volumes = m_cfg.volumes;
+        std::sort(m_volumes.begin(), m_volumes.end());
     }
 
 
@@ -41,7 +47,17 @@ namespace eicrecon {
 
         // create output collections
         auto track_segments = std::make_unique<edm4eic::TrackSegmentCollection>();
-        m_log->debug("Track projector event process. Num of input trajectories: {}", std::size(trajectories));
+
+        // Checked once, so that the per state loop does not format or dispatch log messages
+        const bool debug = m_log->level() <= spdlog::level::debug;
+        if (debug) {
+            m_log->debug("Track projector event process. Num of input trajectories: {}", std::size(trajectories));
+        }
+
+        const auto &gctx = m_geo_provider->getActsGeometryContext();
+
+        // Indices of the states to project, reused for all trajectories
+        std::vector<Acts::MultiTrajectoryTraits::IndexType> states;
 
         // Loop over the trajectories
         for (const auto &traj: trajectories) {
@@ -49,68 +65,82 @@ namespace eicrecon {
             // The trajectory entry indices and the multiTrajectory
             const auto &mj = traj->multiTrajectory();
             const auto &trackTips = traj->tips();
-            m_log->debug("------ Trajectory ------");
-            m_log->debug("  Num of elements in trackTips {}", trackTips.size());
 
             // Skip empty
             if (trackTips.empty()) {
-                m_log->debug("  Empty multiTrajectory.");
+                if (debug) {
+                    m_log->debug("------ Trajectory ------");
+                    m_log->debug("  Empty multiTrajectory.");
+                }
                 continue;
             }
             const auto &trackTip = trackTips.front();
 
-            // Collect the trajectory summary info
-            auto trajState = Acts::MultiTrajectoryHelpers::trajectoryState(mj, trackTip);
-            int m_nMeasurements = trajState.nMeasurements;
-            int m_nStates = trajState.nStates;
+            // Collect the states first, then project them in a single loop
+            states.clear();
             int m_nCalibrated = 0;
-            m_log->debug("  Num measurement in trajectory {}", m_nMeasurements);
-            m_log->debug("  Num state in trajectory {}", m_nStates);
+            mj.visitBackwards(trackTip, [&](const auto &trackstate) {
+                if (trackstate.hasCalibrated()) {
+                    m_nCalibrated++;
+                }
+                states.push_back(trackstate.index());
+            });
+            if (m_cfg.firstLastOnly && states.size() > 2) {
+                states.erase(std::next(states.begin()), std::prev(states.end()));
+            }
+
+            if (debug) {
+                // Collect the trajectory summary info
+                auto trajState = Acts::MultiTrajectoryHelpers::trajectoryState(mj, trackTip);
+                m_log->debug("------ Trajectory ------");
+                m_log->debug("  Num of elements in trackTips {}", trackTips.size());
+                m_log->debug("  Num measurement in trajectory {}", trajState.nMeasurements);
+                m_log->debug("  Num state in trajectory {}", trajState.nStates);
+                m_log->debug("  Num calibrated state in trajectory {}", m_nCalibrated);
+            }
 
             auto track_segment = track_segments->create();
 
-            // visit the track points
-            mj.visitBackwards(trackTip, [&](auto &&trackstate) {
-                // get volume info
-                auto geoID = trackstate.referenceSurface().geometryId();
-                auto volume = geoID.volume();
-                auto layer = geoID.layer();
+            for (const auto index : states) {
+                const auto trackstate = mj.getTrackState(index);
+                const auto &surface = trackstate.referenceSurface();
 
-                if (trackstate.hasCalibrated()) {
-                    m_nCalibrated++;
+                // get volume info
+                auto geoID = surface.geometryId();
+                if (!m_volumes.empty()
+                    && !std::binary_search(m_volumes.begin(), m_volumes.end(), static_cast<int>(geoID.volume()))) {
+                    continue;
                 }
 
                 // get track state bound parameters and their boundCovs
                 const auto &boundParams = trackstate.predicted();
                 const auto &boundCov = trackstate.predictedCovariance();
 
+#if Acts_VERSION_MAJOR >= 34
+                // the free parameters already contain the global position
+                const auto freeParams = Acts::transformBoundToFreeParameters(surface, gctx, boundParams);
+                const Acts::Vector3 global = freeParams.template segment<3>(Acts::eFreePos0);
+                const auto jacobian = surface.boundToFreeJacobian(
+                        gctx,
+                        global,
+                        freeParams.template segment<3>(Acts::eFreeDir0)
+                );
+#else
                 // convert local to global
-                auto global = trackstate.referenceSurface().localToGlobal(
-                        m_geo_provider->getActsGeometryContext(),
+                const Acts::Vector3 global = surface.localToGlobal(
+                        gctx,
                         {boundParams[Acts::eBoundLoc0], boundParams[Acts::eBoundLoc1]},
                         Acts::makeDirectionFromPhiTheta(
                             boundParams[Acts::eBoundPhi],
                             boundParams[Acts::eBoundTheta]
                         )
                 );
-
-#if Acts_VERSION_MAJOR >= 34
-                auto freeParams = Acts::transformBoundToFreeParameters(
-                        trackstate.referenceSurface(),
-                        m_geo_provider->getActsGeometryContext(),
-                        boundParams);
-                auto jacobian = trackstate.referenceSurface().boundToFreeJacobian(
-                        m_geo_provider->getActsGeometryContext(),
-                        freeParams.template segment<3>(Acts::eFreePos0),
-                        freeParams.template segment<3>(Acts::eFreeDir0)
-                );
-#else
-                auto jacobian = trackstate.referenceSurface().boundToFreeJacobian(
-                        m_geo_provider->getActsGeometryContext(),
-                        boundParams
-                );
+                const auto jacobian = surface.boundToFreeJacobian(gctx, boundParams);
 #endif
-                auto freeCov = jacobian * boundCov * jacobian.transpose();
+                // only the position block of the free covariance is stored
+                const Acts::ActsMatrix<3, Acts::eBoundSize> posJacobian =
+                        jacobian.template block<3, Acts::eBoundSize>(Acts::eFreePos0, 0);
+                const Acts::ActsMatrix<3, 3> posCov = posJacobian * boundCov * posJacobian.transpose();
 
                 // global position
                 const decltype(edm4eic::TrackPoint::position) position{
@@ -118,24 +148,13 @@ namespace eicrecon {
                         static_cast<float>(global.y()),
                         static_cast<float>(global.z())
                 };
-
-                // local position
-                const decltype(edm4eic::TrackParametersData::loc) loc{
-                        static_cast<float>(boundParams[Acts::eBoundLoc0]),
-                        static_cast<float>(boundParams[Acts::eBoundLoc1])
-                };
-                const edm4eic::Cov2f locError{
-                        static_cast<float>(boundCov(Acts::eBoundLoc0, Acts::eBoundLoc0)),
-                        static_cast<float>(boundCov(Acts::eBoundLoc1, Acts::eBoundLoc1)),
-                        static_cast<float>(boundCov(Acts::eBoundLoc0, Acts::eBoundLoc1))
-                };
                 const decltype(edm4eic::TrackPoint::positionError) positionError{
-                        static_cast<float>(freeCov(Acts::eFreePos0, Acts::eFreePos0)),
-                        static_cast<float>(freeCov(Acts::eFreePos1, Acts::eFreePos1)),
-                        static_cast<float>(freeCov(Acts::eFreePos2, Acts::eFreePos2)),
-                        static_cast<float>(freeCov(Acts::eFreePos0, Acts::eFreePos1)),
-                        static_cast<float>(freeCov(Acts::eFreePos0, Acts::eFreePos2)),
-                        static_cast<float>(freeCov(Acts::eFreePos1, Acts::eFreePos2)),
+                        static_cast<float>(posCov(0, 0)),
+                        static_cast<float>(posCov(1, 1)),
+                        static_cast<float>(posCov(2, 2)),
+                        static_cast<float>(posCov(0, 1)),
+                        static_cast<float>(posCov(0, 2)),
+                        static_cast<float>(posCov(1, 2)),
                 };
 
                 // momentum
@@ -164,12 +183,12 @@ namespace eicrecon {
                 const float pathLength = static_cast<float>(trackstate.pathLength());
                 const float pathLengthError = 0;
 
-                uint64_t surface = trackstate.referenceSurface().geometryId().value();
+                uint64_t surface_id = geoID.value();
                 uint32_t system = 0;
 
                 // Store track point
                 track_segment.addToPoints({
-                                                  surface,
+                                                  surface_id,
                                                   system,
                                                   position,
                                                   positionError,
@@ -184,40 +203,35 @@ namespace eicrecon {
                                                   pathLengthError
                                           });
 
+                if (debug) {
+                    m_log->debug("  ******************************");
+                    m_log->debug("    position: {}", position);
+                    m_log->debug("    positionError: {}", positionError);
+                    m_log->debug("    momentum: {}", momentum);
+                    m_log->debug("    momentumError: {}", momentumError);
+                    m_log->debug("    time: {}", time);
+                    m_log->debug("    timeError: {}", timeError);
+                    m_log->debug("    theta: {}", theta);
+                    m_log->debug("    phi: {}", phi);
+                    m_log->debug("    directionError: {}", directionError);
+                    m_log->debug("    pathLength: {}", pathLength);
+                    m_log->debug("    pathLengthError: {}", pathLengthError);
+                    m_log->debug("    geoID = {}", geoID);
+                    m_log->debug("    volume = {}, layer = {}", geoID.volume(), geoID.layer());
+                    m_log->debug("    hasCalibrated = {}", trackstate.hasCalibrated());
+                    m_log->debug("  ******************************");
+                }
+            }
 
-                m_log->debug("  ******************************");
-                m_log->debug("    position: {}", position);
-                m_log->debug("    positionError: {}", positionError);
-                m_log->debug("    momentum: {}", momentum);
-                m_log->debug("    momentumError: {}", momentumError);
-                m_log->debug("    time: {}", time);
-                m_log->debug("    timeError: {}", timeError);
-                m_log->debug("    theta: {}", theta);
-                m_log->debug("    phi: {}", phi);
-                m_log->debug("    directionError: {}", directionError);
-                m_log->debug("    pathLength: {}", pathLength);
-                m_log->debug("    pathLengthError: {}", pathLengthError);
-                m_log->debug("    geoID = {}", geoID);
-                m_log->debug("    volume = {}, layer = {}", volume, layer);
-                m_log->debug("    pathlength = {}", pathLength);
-                m_log->debug("    hasCalibrated = {}", trackstate.hasCalibrated());
-                m_log->debug("  ******************************");
-
-                // Local position on the reference surface.
-                //m_log->debug("boundParams[eBoundLoc0] = {}", boundParams[Acts::eBoundLoc0]);
-                //m_log->debug("boundParams[eBoundLoc1] = {}", boundParams[Acts::eBoundLoc1]);
-                //m_log->debug("boundParams[eBoundPhi] = {}", boundParams[Acts::eBoundPhi]);
-                //m_log->debug("boundParams[eBoundTheta] = {}", boundParams[Acts::eBoundTheta]);
-                //m_log->debug("boundParams[eBoundQOverP] = {}", boundParams[Acts::eBoundQOverP]);
-                //m_log->debug("boundParams[eBoundTime] = {}", boundParams[Acts::eBoundTime]);
-                //m_log->debug("predicted variables: {}", trackstate.predicted());
-            });
-
-            m_log->debug("  Num calibrated state in trajectory {}", m_nCalibrated);
-            m_log->debug("------ end of trajectory process ------");
+            if (debug) {
+                m_log->debug("  Num track points stored {}", track_segment.points_size());
+                m_log->debug("------ end of trajectory process ------");
+            }
         }
 
-        m_log->debug("END OF Track projector event process");
+        if (debug) {
+            m_log->debug("END OF Track projector event process");
+        }
         return std::move(track_segments);
     }
 
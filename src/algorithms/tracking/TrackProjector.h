@@ -11,6 +11,8 @@
 #include <vector>
 
 #include "ActsGeometryProvider.h"
+#include "TrackProjectorConfig.h"
+#include "algorithms/interfaces/WithPodConfig.h"
 
 
 namespace eicrecon {
@@ -19,7 +21,7 @@ namespace eicrecon {
          *
          * \ingroup tracking
          */
-        class TrackProjector {
+        class TrackProjector : public eicrecon::WithPodConfig<eicrecon::TrackProjectorConfig> {
 
         public:
 
@@ -31,6 +33,9 @@ namespace eicrecon {
             std::shared_ptr<const ActsGeometryProvider> m_geo_provider;
             std::shared_ptr<spdlog::logger> m_log;
 
+            /// Geometry volumes to keep, sorted (from config)
+            std::vector<int> m_volumes;
+
         };
 
 
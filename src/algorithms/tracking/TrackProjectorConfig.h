@@ -0,0 +1,17 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2024 EICrecon Authors
+
+#pragma once
+
+#include <vector>
+
+namespace eicrecon {
+
+struct TrackProjectorConfig {
+  // Only emit the first and last state of each trajectory
+  bool firstLastOnly = false;
+  // Only emit states on surfaces in these geometry volumes (empty: all)
+  std::vector<int> volumes = {};
+};
+
+} // namespace eicrecon
@@ -46,8 +46,8 @@ std::unique_ptr<edm4eic::TrackerHitCollection> TrackerHitReconstruction::process
         auto id = raw_hit.getCellID();
 
         // Get position and dimension
-        auto pos = m_converter->position(id);
-        auto dim = m_converter->cellDimensions(id);
+        auto pos = m_cellid_geo.position(id);
+        auto dim = m_cellid_geo.cellDimensions(id);
 
         // >oO trace
         if(m_log->level() == spdlog::level::trace) {
@@ -10,6 +10,7 @@
 #include <memory>
 
 #include "TrackerHitReconstructionConfig.h"
+#include "algorithms/interfaces/CellIDGeometrySvc.h"
 #include "algorithms/interfaces/WithPodConfig.h"
 
 namespace eicrecon {
@@ -35,5 +36,8 @@ namespace eicrecon {
 
         /// Cell ID position converter
         const dd4hep::rec::CellIDPositionConverter* m_converter;
+
+        /// Precomputed cell geometry, falls back to the converter for other readouts
+        const CellIDGeometrySvc& m_cellid_geo{CellIDGeometrySvc::instance()};
     };
 }
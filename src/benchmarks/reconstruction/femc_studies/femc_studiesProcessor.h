@@ -82,6 +82,7 @@ public:
     std::string nameSimHits         = "EcalEndcapPHits";
     std::string nameRecHits         = "EcalEndcapPRecHits";
     std::string nameClusters        = "EcalEndcapPClusters";
+    std::string nameMAClusters      = "EcalEndcapPMAClusters";
     std::string nameProtoClusters   = "EcalEndcapPIslandProtoClusters";
     short iLx;
     short iLy;
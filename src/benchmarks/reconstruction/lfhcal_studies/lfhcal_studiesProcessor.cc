@@ -20,6 +20,7 @@
 #include <edm4hep/MCParticleCollection.h>
 #include <edm4hep/SimCalorimeterHitCollection.h>
 #include <edm4hep/Vector3f.h>
+#include <edm4hep/utils/vector_utils.h>
 #include <fmt/core.h>
 #include <podio/RelationRange.h>
 #include <stdint.h>
@@ -29,10 +30,11 @@
 #include <iostream>
 #include <limits>
 #include <map>
+#include <numeric>
 #include <stdexcept>
 #include <vector>
 
-#include "clusterizer_MA.h"
+#include "towers.h"
 #include "services/geometry/dd4hep/DD4hep_service.h"
 #include "services/log/Log_service.h"
 #include "services/rootfile/RootFile_service.h"
@@ -500,92 +502,50 @@ void lfhcal_studiesProcessor::Process(const std::shared_ptr<const JEvent>& event
   hClusterESimcalib_E_phi->Fill(mcenergy, tot_energySimHit/mcenergy, mcphi);
 
   // ===============================================================================================
-  // MA clusterization
+  // MA clusters, see CalorimeterMACluster
   // ===============================================================================================
-  int removedCells  = 0;
-  float minAggE     = 0.001;
-  float seedE       = 0.100;
+  const auto &maClusters = *(event->GetCollection<edm4eic::Cluster>(nameMAClusters));
 
-  if (!input_tower_rec.empty()){
+  // order by energy, highest first
+  std::vector<size_t> maClusterOrder(maClusters.size());
+  std::iota(maClusterOrder.begin(), maClusterOrder.end(), 0);
+  std::sort(maClusterOrder.begin(), maClusterOrder.end(), [&maClusters](size_t a, size_t b) {
+    return maClusters[a].getEnergy() > maClusters[b].getEnergy();
+  });
 
-    // clean up rec array for clusterization
-    while (input_tower_rec.at(input_tower_rec.size()-1).energy < minAggE ){
-      input_tower_rec.pop_back();
-      removedCells++;
+  std::map<int, size_t> towerIndexRecSav;
+  for (size_t iTower = 0; iTower < input_tower_recSav.size(); iTower++) {
+    towerIndexRecSav.emplace(input_tower_recSav.at(iTower).cellID, iTower);
+  }
+
+  m_log->info("-----> found {} clusters" , maClusters.size());
+  hRecNClusters_E_eta->Fill(mcenergy, maClusters.size(), mceta);
+  int iCl = 0;
+  for (const size_t iMACl : maClusterOrder) {
+    const auto cluster = maClusters[iMACl];
+    const float clusterEta = edm4hep::utils::eta(cluster.getPosition());
+    const float clusterPhi = edm4hep::utils::angleAzimuthal(cluster.getPosition());
+    if (iCl < maxNCluster && enableTreeCluster){
+      t_lFHCal_cluster_E[iCl]       = (float)cluster.getEnergy();
+      t_lFHCal_cluster_NCells[iCl]  = (int)cluster.getNhits();
+      t_lFHCal_cluster_Eta[iCl]     = clusterEta;
+      t_lFHCal_cluster_Phi[iCl]     = clusterPhi;
     }
-    m_log->trace("removed {} with E < {} GeV", removedCells, minAggE);
-
-    int nclusters = 0;
-    // vector of clusters
-    std::vector<clustersStrct> clusters_calo;
-    // vector of towers within the currently found cluster
-    std::vector<towersStrct> cluster_towers;
-    while (!input_tower_rec.empty() ) {
-      cluster_towers.clear();
-      clustersStrct tempstructC;
-      // always start with highest energetic tower
-      if(input_tower_rec.at(0).energy > seedE){
-        m_log->trace("seed: {}\t {} \t {}", input_tower_rec.at(0).energy, input_tower_rec.at(0).cellIDx, input_tower_rec.at(0).cellIDy,  input_tower_rec.at(0).cellIDz);
-        tempstructC = findMACluster(seedE, minAggE, input_tower_rec, cluster_towers);
-
-        // determine remaining cluster properties from its towers
-        float* showershape_eta_phi = CalculateM02andWeightedPosition(cluster_towers, tempstructC.cluster_E, 4.5);
-        tempstructC.cluster_M02 = showershape_eta_phi[0];
-        tempstructC.cluster_M20 = showershape_eta_phi[1];
-        tempstructC.cluster_Eta = showershape_eta_phi[2];
-        tempstructC.cluster_Phi = showershape_eta_phi[3];
-        tempstructC.cluster_X = showershape_eta_phi[4];
-        tempstructC.cluster_Y = showershape_eta_phi[5];
-        tempstructC.cluster_Z = showershape_eta_phi[6];
-        tempstructC.cluster_towers = cluster_towers;
-        m_log->trace("---------> \t {} \tcluster with E = {} \tEta: {} \tPhi: {} \tX: {} \tY: {} \tZ: {} \tntowers: {} \ttrueID: {}", nclusters, tempstructC.cluster_E, tempstructC.cluster_Eta, tempstructC.cluster_Phi, tempstructC.cluster_X, tempstructC.cluster_Y, tempstructC.cluster_Z, tempstructC.cluster_NTowers, tempstructC.cluster_trueID );
-        clusters_calo.push_back(tempstructC);
-
-        clusters_calo.push_back(tempstructC);
-
-        nclusters++;
-      } else {
-        m_log->trace("remaining: {} largest: {} \t {}  \t {}  \t {}", (int)input_tower_rec.size(), input_tower_rec.at(0).energy, input_tower_rec.at(0).cellIDx, input_tower_rec.at(0).cellIDy,  input_tower_rec.at(0).cellIDz);
-        input_tower_rec.clear();
-      }
+    hRecClusterEcalib_E_eta->Fill(mcenergy, cluster.getEnergy()/mcenergy, mceta);
+    for (const auto hit : cluster.getHits()) {
+      const auto tower = towerIndexRecSav.find((int)hit.getCellID());
+      if (tower != towerIndexRecSav.end())
+        input_tower_recSav.at(tower->second).tower_clusterIDA = iCl;
     }
 
-    // -----------------------------------------------------------------------------------------------
-    // --------------------------- Fill LFHCal MA clusters in tree and hists -------------------------
-    // -----------------------------------------------------------------------------------------------
-    std::sort(clusters_calo.begin(), clusters_calo.end(), &acompareCl);
-    m_log->info("-----> found {} clusters" , clusters_calo.size());
-    hRecNClusters_E_eta->Fill(mcenergy, clusters_calo.size(), mceta);
-    int iCl = 0;
-    for (const auto cluster : clusters_calo) {
-      if (iCl < maxNCluster && enableTreeCluster){
-        t_lFHCal_cluster_E[iCl]       = (float)cluster.cluster_E;
-        t_lFHCal_cluster_NCells[iCl]  = (int)cluster.cluster_NTowers;
-        t_lFHCal_cluster_Eta[iCl]     = (float)cluster.cluster_Eta;
-        t_lFHCal_cluster_Phi[iCl]     = (float)cluster.cluster_Phi;
-      }
-      hRecClusterEcalib_E_eta->Fill(mcenergy, cluster.cluster_E/mcenergy, mceta);
-      for (int iCell = 0; iCell < (int)cluster.cluster_towers.size(); iCell++){
-        int pSav = 0;
-        while(cluster.cluster_towers.at(iCell).cellID !=  input_tower_recSav.at(pSav).cellID && pSav < (int)input_tower_recSav.size() ) pSav++;
-        if (cluster.cluster_towers.at(iCell).cellID == input_tower_recSav.at(pSav).cellID)
-          input_tower_recSav.at(pSav).tower_clusterIDA = iCl;
-      }
-
-      if (iCl == 0){
-        hRecClusterEcalib_Ehigh_eta->Fill(mcenergy, cluster.cluster_E/mcenergy, mceta);
-        hRecClusterNCells_Ehigh_eta->Fill(mcenergy, cluster.cluster_NTowers, mceta);
-      }
-      iCl++;
-      m_log->trace("MA cluster {}:\t {} \t {}", iCl, cluster.cluster_E, cluster.cluster_NTowers);
+    if (iCl == 0){
+      hRecClusterEcalib_Ehigh_eta->Fill(mcenergy, cluster.getEnergy()/mcenergy, mceta);
+      hRecClusterNCells_Ehigh_eta->Fill(mcenergy, cluster.getNhits(), mceta);
     }
-    if (iCl < maxNCluster && enableTreeCluster) t_lFHCal_clusters_N = (int)iCl;
-
-    clusters_calo.clear();
-  } else {
-    hRecNClusters_E_eta->Fill(mcenergy, 0., mceta);
-    if (enableTreeCluster) t_lFHCal_clusters_N = 0;
+    iCl++;
+    m_log->trace("MA cluster {}:\t {} \t {}", iCl, cluster.getEnergy(), cluster.getNhits());
   }
+  if (enableTreeCluster) t_lFHCal_clusters_N = std::min(iCl, maxNCluster);
 
   // ===============================================================================================
   // ------------------------------- Fill LFHCAl Island clusters in hists --------------------------
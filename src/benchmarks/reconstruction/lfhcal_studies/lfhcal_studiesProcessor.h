@@ -99,6 +99,7 @@ public:
     std::string nameSimHits         = "LFHCALHits";
     std::string nameRecHits         = "LFHCALRecHits";
     std::string nameClusters        = "LFHCALClusters";
+    std::string nameMAClusters      = "LFHCALMAClusters";
     std::string nameProtoClusters   = "LFHCALIslandProtoClusters";
     short iPassive;
     short iLx;
@@ -13,6 +13,8 @@
 #include <string>
 #include <vector>
 
+#include "services/rootfile/ThreadLocalHist.h"
+
 class TrackingOccupancyAnalysis {
 
 public:
@@ -38,11 +40,11 @@ private:
     };
 
     /// Hits count histogram for each hits readout name
-    std::vector<std::shared_ptr<TH1F>> m_hits_count_hists;
+    std::vector<std::shared_ptr<ThreadLocalHist<TH1F>>> m_hits_count_hists;
 
     /// Hits occupancy histogram for each hits readout name
-    std::vector<std::shared_ptr<TH2F>> m_hits_occup_hists;
+    std::vector<std::shared_ptr<ThreadLocalHist<TH2F>>> m_hits_occup_hists;
 
     /// Total occupancy of all m_data_names
-    TH2F * m_total_occup_th2;                 /// MC Particles px,py
+    std::shared_ptr<ThreadLocalHist<TH2F>> m_total_occup_th2;
 };
@@ -36,8 +36,6 @@ extern "C" {
 
     // digitization
     PhotoMultiplierHitDigiConfig digi_cfg;
-    digi_cfg.seed            = 5; // FIXME: set to 0 for a 'unique' seed, but
-                                  // that seems to delay the RNG from actually randomizing
     digi_cfg.hitTimeWindow   = 20.0; // [ns]
     digi_cfg.timeResolution  = 1/16.0; // [ns]
     digi_cfg.speMean         = 80.0;
@@ -77,7 +75,7 @@ extern "C" {
     // digitization
     app->Add(new JOmniFactoryGeneratorT<PhotoMultiplierHitDigi_factory>(
           "DIRCRawHits",
-          {"DIRCBarHits"},
+          {"EventHeader", "DIRCBarHits"},
           {"DIRCRawHits", "DIRCRawHitsAssociations"},
           digi_cfg,
           app
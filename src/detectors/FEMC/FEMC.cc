@@ -14,6 +14,7 @@
 #include "factories/calorimetry/CalorimeterHitDigi_factory.h"
 #include "factories/calorimetry/CalorimeterHitReco_factory.h"
 #include "factories/calorimetry/CalorimeterIslandCluster_factory.h"
+#include "factories/calorimetry/CalorimeterMACluster_factory.h"
 #include "factories/calorimetry/CalorimeterTruthClustering_factory.h"
 
 extern "C" {
@@ -113,6 +114,36 @@ extern "C" {
           )
         );
 
+        app->Add(new JOmniFactoryGeneratorT<CalorimeterMACluster_factory>(
+          "EcalEndcapPMAProtoClusters", {"EcalEndcapPRecHits"}, {"EcalEndcapPMAProtoClusters"},
+          {
+            .readout = "EcalEndcapPHits",
+            .cellIndexX = "x",
+            .cellIndexY = "y",
+            .minClusterSeedEdep = 200.0 * dd4hep::MeV,
+            .minClusterHitEdep = 1 * dd4hep::MeV,
+            .aggregationMargin = 100.0 * dd4hep::MeV,
+          },
+          app   // TODO: Remove me once fixed
+        ));
+
+        app->Add(
+          new JOmniFactoryGeneratorT<CalorimeterClusterRecoCoG_factory>(
+             "EcalEndcapPMAClusters",
+            {"EcalEndcapPMAProtoClusters",        // edm4eic::ProtoClusterCollection
+             "EcalEndcapPHits"},                  // edm4hep::SimCalorimeterHitCollection
+            {"EcalEndcapPMAClusters",             // edm4eic::Cluster
+             "EcalEndcapPMAClusterAssociations"}, // edm4eic::MCRecoClusterParticleAssociation
+            {
+              .energyWeight = "log",
+              .sampFrac = 1.0,
+              .logWeightBase = 4.5,
+              .enableEtaBounds = false,
+            },
+            app   // TODO: Remove me once fixed
+          )
+        );
+
         // Insert is identical to regular Ecal
         app->Add(new JOmniFactoryGeneratorT<CalorimeterHitDigi_factory>(
           "EcalEndcapPInsertRawHits", {"EcalEndcapPInsertHits"}, {"EcalEndcapPInsertRawHits"},
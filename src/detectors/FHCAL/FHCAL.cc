@@ -20,6 +20,7 @@
 #include "factories/calorimetry/CalorimeterHitReco_factory.h"
 #include "factories/calorimetry/CalorimeterHitsMerger_factory.h"
 #include "factories/calorimetry/CalorimeterIslandCluster_factory.h"
+#include "factories/calorimetry/CalorimeterMACluster_factory.h"
 #include "factories/calorimetry/CalorimeterTruthClustering_factory.h"
 #include "factories/calorimetry/HEXPLIT_factory.h"
 #include "factories/calorimetry/ImagingTopoCluster_factory.h"
@@ -234,6 +235,20 @@ extern "C" {
           app   // TODO: Remove me once fixed
         ));
 
+        app->Add(new JOmniFactoryGeneratorT<CalorimeterMACluster_factory>(
+          "LFHCALMAProtoClusters", {"LFHCALRecHits"}, {"LFHCALMAProtoClusters"},
+          {
+            .readout = "LFHCALHits",
+            .cellIndexX = "54*2-moduleIDx*2-towerx",
+            .cellIndexY = "54*2-moduleIDy*2-towery",
+            .cellIndexZ = "rlayerz",
+            .minClusterSeedEdep = 100.0 * dd4hep::MeV,
+            .minClusterHitEdep = 1 * dd4hep::MeV,
+            .aggregationMargin = 1.0 * dd4hep::GeV,
+          },
+          app   // TODO: Remove me once fixed
+        ));
+
         app->Add(
           new JOmniFactoryGeneratorT<CalorimeterClusterRecoCoG_factory>(
              "LFHCALTruthClusters",
@@ -269,5 +284,23 @@ extern "C" {
             app   // TODO: Remove me once fixed
           )
         );
+
+        app->Add(
+          new JOmniFactoryGeneratorT<CalorimeterClusterRecoCoG_factory>(
+             "LFHCALMAClusters",
+            {"LFHCALMAProtoClusters",        // edm4eic::ProtoClusterCollection
+             "LFHCALHits"},                  // edm4hep::SimCalorimeterHitCollection
+            {"LFHCALMAClusters",             // edm4eic::Cluster
+             "LFHCALMAClusterAssociations"}, // edm4eic::MCRecoClusterParticleAssociation
+            {
+              .energyWeight = "log",
+              .sampFrac = 1.0,
+              .logWeightBase = 4.5,
+              .longitudinalShowerInfoAvailable = true,
+              .enableEtaBounds = false,
+            },
+            app   // TODO: Remove me once fixed
+          )
+        );
     }
 }
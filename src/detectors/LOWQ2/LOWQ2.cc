@@ -110,6 +110,7 @@ extern "C" {
           {outputTrackTag},
           {
             .layer_hits_max = 100,
+            .road_layer_hits_max = 1000,
             .chi2_max = 0.001,
             .n_layer = 4,
             .restrict_direction = true,
@@ -34,8 +34,6 @@ extern "C" {
 
     // digitization
     PhotoMultiplierHitDigiConfig digi_cfg;
-    digi_cfg.seed            = 5; // FIXME: set to 0 for a 'unique' seed, but
-                                  // that seems to delay the RNG from actually randomizing
     digi_cfg.hitTimeWindow   = 20.0; // [ns]
     digi_cfg.timeResolution  = 1/16.0; // [ns]
     digi_cfg.speMean         = 80.0;
@@ -71,7 +69,7 @@ extern "C" {
     // digitization
     app->Add(new JOmniFactoryGeneratorT<PhotoMultiplierHitDigi_factory>(
           "RICHEndcapNRawHits",
-          {"RICHEndcapNHits"},
+          {"EventHeader", "RICHEndcapNHits"},
           {"RICHEndcapNRawHits", "RICHEndcapNRawHitsAssociations"},
           digi_cfg,
           app
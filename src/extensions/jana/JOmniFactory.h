@@ -15,6 +15,7 @@
 #include <JANA/JEvent.h>
 #include <spdlog/spdlog.h>
 
+#include "extensions/jana/JOmniFactoryGraph.h"
 #include "services/io/podio/datamodel_glue.h"
 #include "services/log/Log_service.h"
 
@@ -35,6 +36,7 @@ public:
         std::string type_name;
         std::vector<std::string> collection_names;
         bool is_variadic = false;
+        bool is_optional = false;
 
         virtual void GetCollection(const JEvent& event) = 0;
     };
@@ -69,10 +71,13 @@ public:
 
     public:
 
-        PodioInput(JOmniFactory* owner, std::string default_collection_name="") {
+        /// An optional input is left unconnected by giving it an empty
+        /// collection name, operator() then returns nullptr
+        PodioInput(JOmniFactory* owner, std::string default_collection_name="", bool is_optional=false) {
             owner->RegisterInput(this);
             this->collection_names.push_back(default_collection_name);
             this->type_name = JTypeInfo::demangle<PodioT>();
+            this->is_optional = is_optional;
         }
 
         const typename PodioTypeMap<PodioT>::collection_t* operator()() {
@@ -83,6 +88,10 @@ public:
         friend class JOmniFactory;
 
         void GetCollection(const JEvent& event) {
+            if (this->is_optional && this->collection_names[0].empty()) {
+                m_data = nullptr;
+                return;
+            }
             m_data = event.GetCollection<PodioT>(this->collection_names[0]);
         }
     };
@@ -528,6 +537,34 @@ public:
 
         // Obtain logger (defines the parameter option)
         m_logger = m_app->GetService<Log_service>()->logger(m_prefix);
+
+        // Declare our data flow for intra-event parallel execution
+        RegisterWithGraph();
+    }
+
+    void RegisterWithGraph() {
+        std::vector<std::string> input_names;
+        std::vector<std::string> output_names;
+        for (auto* input : m_inputs) {
+            for (const auto& name : input->collection_names) {
+                // Unconnected optional input
+                if (!name.empty()) {
+                    input_names.push_back(name);
+                }
+            }
+        }
+        for (auto* output : m_outputs) {
+            output_names.insert(output_names.end(), output->collection_names.begin(), output->collection_names.end());
+        }
+        if (output_names.empty()) {
+            return;
+        }
+        try {
+            m_app->GetService<JOmniFactoryGraph>()->Register(m_prefix, input_names, output_names);
+        }
+        catch (JException&) {
+            // No graph service provided (e.g. without the podio plugin): lazy serial execution only
+        }
     }
 
     void Init() override {
@@ -556,7 +593,11 @@ public:
             for (auto* output : m_outputs) {
                 output->Reset();
             }
-            static_cast<AlgoT*>(this)->Process(event->GetRunNumber(), event->GetEventNumber());
+            // Inputs and outputs go through the JEvent; only the algorithm may overlap
+            // with other factories of the same event (see JOmniFactoryGraph)
+            JOmniFactoryGraph::RunUnlocked(m_prefix, [this, &event] {
+                static_cast<AlgoT*>(this)->Process(event->GetRunNumber(), event->GetEventNumber());
+            });
             for (auto* output : m_outputs) {
                 output->SetCollection(*this);
             }
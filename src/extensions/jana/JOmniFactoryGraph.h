@@ -0,0 +1,246 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2024 EICrecon Authors
+
+#pragma once
+
+#include <JANA/JEvent.h>
+#include <JANA/Services/JServiceLocator.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "extensions/jana/JWorkStealingPool.h"
+
+/**
+ * Data flow graph of all JOmniFactories, built from the input and output
+ * collection names each factory declares in PreInit().
+ *
+ * From this graph, Execute() runs the factories needed for a set of target
+ * collections concurrently within one event: a factory is submitted to a
+ * work-stealing pool as soon as all factories producing its inputs have
+ * finished, so independent chains (e.g. the calorimeters, tracking, RICH)
+ * overlap. Each factory is triggered exactly once through the usual lazy
+ * JEvent::GetCollectionBase(), so consumers keep the lazy semantics and
+ * simply find the collections already present.
+ *
+ * JEvent, JFactory and JCallGraphRecorder are not documented to be re-entrant,
+ * so all calls into them are serialized with a per-event mutex, held while a
+ * factory is triggered. Only the algorithm body of the triggered factory runs
+ * with the mutex released (see RunUnlocked()): that is the same code JANA
+ * already runs concurrently for different events, on inputs that are complete
+ * and no longer modified. Any other factory triggered lazily from within (e.g.
+ * an undeclared input) runs entirely under the mutex.
+ *
+ * Call graph recording (janatop) keeps execution serial.
+ */
+class JOmniFactoryGraph : public JService {
+public:
+
+    struct Node {
+        std::string prefix;
+        std::vector<std::string> inputs;
+        std::vector<std::string> outputs;
+    };
+
+    /// Subgraph needed for a set of targets, in topological order
+    struct Plan {
+        std::vector<std::string> trigger;                  // one output collection per node
+        std::vector<std::string> prefix;                   // factory prefix per node
+        std::vector<std::vector<std::size_t>> dependents;  // nodes waiting for each node
+        std::vector<std::size_t> dependency_count;
+        std::vector<std::string> external_inputs;          // inputs not produced by any node
+    };
+
+    /// Called by every JOmniFactory instance; instances for other event slots are de-duplicated
+    void Register(const std::string& prefix, const std::vector<std::string>& inputs, const std::vector<std::string>& outputs) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_nodes.try_emplace(prefix, Node{prefix, inputs, outputs});
+    }
+
+    void SetThreadCount(std::size_t n_threads) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (n_threads > 0 && (m_pool == nullptr || m_pool->GetThreadCount() != n_threads)) {
+            m_pool = std::make_unique<JWorkStealingPool>(n_threads);
+        }
+    }
+
+    std::shared_ptr<const Plan> MakePlan(const std::vector<std::string>& targets) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        std::map<std::string, const Node*> producer;
+        for (const auto& [prefix, node] : m_nodes) {
+            for (const auto& output : node.outputs) {
+                producer[output] = &node;
+            }
+        }
+
+        // Depth-first walk from the targets gives a topological order
+        auto plan = std::make_shared<Plan>();
+        std::map<const Node*, std::size_t> index;
+        std::set<const Node*> visiting;
+        std::set<std::string> external;
+        std::vector<std::vector<std::size_t>> node_inputs;
+
+        std::function<void(const Node*)> visit = [&](const Node* node) {
+            if (index.count(node) || visiting.count(node)) {
+                return;
+            }
+            visiting.insert(node);
+            std::vector<std::size_t> upstream;
+            for (const auto& input : node->inputs) {
+                auto it = producer.find(input);
+                if (it == producer.end()) {
+                    external.insert(input);
+                    continue;
+                }
+                visit(it->second);
+                if (index.count(it->second)) {
+                    upstream.push_back(index[it->second]);
+                }
+            }
+            visiting.erase(node);
+            index[node] = plan->trigger.size();
+            plan->trigger.push_back(node->outputs.front());
+            plan->prefix.push_back(node->prefix);
+            node_inputs.push_back(upstream);
+        };
+        for (const auto& target : targets) {
+            auto it = producer.find(target);
+            if (it != producer.end()) {
+                visit(it->second);
+            }
+        }
+
+        plan->dependents.resize(plan->trigger.size());
+        plan->dependency_count.resize(plan->trigger.size());
+        for (std::size_t i = 0; i < node_inputs.size(); ++i) {
+            std::set<std::size_t> unique(node_inputs[i].begin(), node_inputs[i].end());
+            plan->dependency_count[i] = unique.size();
+            for (std::size_t j : unique) {
+                plan->dependents[j].push_back(i);
+            }
+        }
+        plan->external_inputs.assign(external.begin(), external.end());
+        return plan;
+    }
+
+    /// Run `body`, with the event mutex released if the calling pool task was
+    /// submitted for the factory with this prefix; otherwise just run it
+    static void RunUnlocked(const std::string& prefix, const std::function<void()>& body) {
+        if (t_current.lock == nullptr || t_current.prefix == nullptr || *t_current.prefix != prefix) {
+            body();
+            return;
+        }
+        // Only once per task: nested factories keep the mutex
+        auto* lock = t_current.lock;
+        t_current = {};
+        lock->unlock();
+        try {
+            body();
+        }
+        catch (...) {
+            lock->lock();
+            throw;
+        }
+        lock->lock();
+    }
+
+    void Execute(const JEvent& event, const Plan& plan) {
+        JWorkStealingPool* pool = m_pool.get();
+        if (pool == nullptr || plan.trigger.empty()) {
+            return;
+        }
+        if (event.GetJCallGraphRecorder()->IsEnabled()) {
+            return;
+        }
+
+        // Inputs from the event source or from non-omnifactories are triggered serially
+        // first, so that concurrent factories never race to create a shared input
+        for (const auto& input : plan.external_inputs) {
+            try {
+                [[maybe_unused]] const auto* coll = event.GetCollectionBase(input);
+            } catch (std::exception&) {
+                // Reported again when the consumer asks for it
+            }
+        }
+
+        struct State {
+            std::vector<std::atomic<std::size_t>> remaining;
+            std::vector<std::atomic<bool>> upstream_failed;
+            std::mutex event_mutex;  // serializes all calls into the JEvent
+            std::size_t finished{0};
+            std::mutex mutex;
+            std::condition_variable cv;
+            explicit State(std::size_t n) : remaining(n), upstream_failed(n) {}
+        };
+        auto state = std::make_shared<State>(plan.trigger.size());
+        for (std::size_t i = 0; i < plan.trigger.size(); ++i) {
+            state->remaining[i] = plan.dependency_count[i];
+            state->upstream_failed[i] = false;
+        }
+
+        const std::size_t n_nodes = plan.trigger.size();
+        std::function<void(std::size_t)> run = [&event, &plan, pool, state, n_nodes, &run](std::size_t i) {
+            // Execute() may return (destroying this closure) as soon as the last node is counted
+            auto st = state;
+            const std::size_t n = n_nodes;
+            // Nodes downstream of a failure are left to the consumer, which runs them lazily
+            // (and serially), instead of racing to re-trigger the failed factory
+            bool failed = state->upstream_failed[i];
+            if (!failed) {
+                std::unique_lock<std::mutex> event_lock(state->event_mutex);
+                t_current = {&event_lock, &plan.prefix[i]};
+                try {
+                    [[maybe_unused]] const auto* coll = event.GetCollectionBase(plan.trigger[i]);
+                } catch (std::exception&) {
+                    failed = true;
+                }
+                t_current = {};
+            }
+            for (std::size_t j : plan.dependents[i]) {
+                if (failed) {
+                    state->upstream_failed[j] = true;
+                }
+                if (--state->remaining[j] == 0) {
+                    pool->Submit([&run, j] { run(j); });
+                }
+            }
+            std::lock_guard<std::mutex> lock(st->mutex);
+            if (++st->finished == n) {
+                st->cv.notify_all();
+            }
+        };
+
+        for (std::size_t i = 0; i < plan.trigger.size(); ++i) {
+            if (plan.dependency_count[i] == 0) {
+                pool->Submit([&run, i] { run(i); });
+            }
+        }
+
+        // Help with queued work, then sleep until the last node is done
+        while (pool->RunPendingTask()) {
+        }
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->cv.wait(lock, [&] { return state->finished == n_nodes; });
+    }
+
+private:
+    mutable std::mutex m_mutex;
+    std::map<std::string, Node> m_nodes;
+    std::unique_ptr<JWorkStealingPool> m_pool;
+
+    // Event lock and factory of the pool task running on this thread, for RunUnlocked()
+    struct Current {
+        std::unique_lock<std::mutex>* lock = nullptr;
+        const std::string* prefix = nullptr;
+    };
+    inline static thread_local Current t_current{};
+};
@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2024 EICrecon Authors
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * A small work-stealing thread pool.
+ *
+ * Every worker owns a deque: tasks submitted from a worker go to the back of
+ * its own deque and are taken LIFO (keeping a dependency chain on one core),
+ * idle workers steal FIFO from the front of the other deques. Threads that do
+ * not belong to the pool (e.g. JANA workers waiting for their event) can help
+ * with RunPendingTask() instead of blocking.
+ */
+class JWorkStealingPool {
+public:
+    using Task = std::function<void()>;
+
+    explicit JWorkStealingPool(std::size_t n_threads) {
+        for (std::size_t i = 0; i < n_threads; ++i) {
+            m_queues.push_back(std::make_unique<Queue>());
+        }
+        for (std::size_t i = 0; i < n_threads; ++i) {
+            m_threads.emplace_back([this, i] { WorkerLoop(i); });
+        }
+    }
+
+    ~JWorkStealingPool() {
+        {
+            std::lock_guard<std::mutex> lock(m_wake_mutex);
+            m_stop = true;
+        }
+        m_wake_cv.notify_all();
+        for (auto& thread : m_threads) {
+            thread.join();
+        }
+    }
+
+    JWorkStealingPool(const JWorkStealingPool&) = delete;
+    JWorkStealingPool& operator=(const JWorkStealingPool&) = delete;
+
+    std::size_t GetThreadCount() const { return m_threads.size(); }
+
+    void Submit(Task task) {
+        std::size_t index = (t_pool == this) ? t_index : (m_next++ % m_queues.size());
+        // Counted before the task becomes visible, so m_pending never drops below
+        // the number of queued tasks
+        {
+            std::lock_guard<std::mutex> lock(m_wake_mutex);
+            ++m_pending;
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_queues[index]->mutex);
+            m_queues[index]->tasks.push_back(std::move(task));
+        }
+        m_wake_cv.notify_one();
+    }
+
+    /// Run one queued task on the calling thread, returns false if there was none
+    bool RunPendingTask() {
+        Task task;
+        if (!TrySteal(m_queues.size(), task)) {
+            return false;
+        }
+        task();
+        return true;
+    }
+
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    bool TryPop(std::size_t index, Task& task) {
+        std::lock_guard<std::mutex> lock(m_queues[index]->mutex);
+        if (m_queues[index]->tasks.empty()) {
+            return false;
+        }
+        task = std::move(m_queues[index]->tasks.back());
+        m_queues[index]->tasks.pop_back();
+        --m_pending;
+        return true;
+    }
+
+    bool TrySteal(std::size_t thief, Task& task) {
+        for (std::size_t offset = 1; offset <= m_queues.size(); ++offset) {
+            std::size_t index = (thief + offset) % m_queues.size();
+            if (index == thief) {
+                continue;
+            }
+            std::lock_guard<std::mutex> lock(m_queues[index]->mutex);
+            if (!m_queues[index]->tasks.empty()) {
+                task = std::move(m_queues[index]->tasks.front());
+                m_queues[index]->tasks.pop_front();
+                --m_pending;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void WorkerLoop(std::size_t index) {
+        t_pool  = this;
+        t_index = index;
+        while (true) {
+            Task task;
+            if (TryPop(index, task) || TrySteal(index, task)) {
+                task();
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(m_wake_mutex);
+            m_wake_cv.wait(lock, [this] { return m_stop || m_pending > 0; });
+            if (m_stop && m_pending == 0) {
+                return;
+            }
+        }
+    }
+
+    std::vector<std::unique_ptr<Queue>> m_queues;
+    std::vector<std::thread> m_threads;
+    std::atomic<std::size_t> m_next{0};
+    std::atomic<std::size_t> m_pending{0};
+    bool m_stop{false};
+    std::mutex m_wake_mutex;
+    std::condition_variable m_wake_cv;
+
+    inline static thread_local const JWorkStealingPool* t_pool = nullptr;
+    inline static thread_local std::size_t t_index = 0;
+};
@@ -0,0 +1,50 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2023 Friederike Bock, EICrecon Authors
+
+#pragma once
+
+#include "algorithms/calorimetry/CalorimeterMACluster.h"
+#include "services/algorithms_init/AlgorithmsInit_service.h"
+#include "extensions/jana/JOmniFactory.h"
+
+
+namespace eicrecon {
+
+class CalorimeterMACluster_factory : public JOmniFactory<CalorimeterMACluster_factory, CalorimeterMAClusterConfig> {
+public:
+    using AlgoT = eicrecon::CalorimeterMACluster;
+private:
+    std::unique_ptr<AlgoT> m_algo;
+
+    PodioInput<edm4eic::CalorimeterHit> m_calo_hit_input {this};
+    PodioOutput<edm4eic::ProtoCluster> m_proto_cluster_output {this};
+
+    ParameterRef<std::string> m_readout {this, "readoutClass", config().readout};
+    ParameterRef<std::string> m_cellIndexX {this, "cellIndexX", config().cellIndexX};
+    ParameterRef<std::string> m_cellIndexY {this, "cellIndexY", config().cellIndexY};
+    ParameterRef<std::string> m_cellIndexZ {this, "cellIndexZ", config().cellIndexZ};
+    ParameterRef<double> m_minClusterSeedEdep {this, "minClusterSeedEdep", config().minClusterSeedEdep};
+    ParameterRef<double> m_minClusterHitEdep {this, "minClusterHitEdep", config().minClusterHitEdep};
+    ParameterRef<double> m_aggregationMargin {this, "aggregationMargin", config().aggregationMargin};
+
+    Service<AlgorithmsInit_service> m_algorithmsInit {this};
+
+public:
+
+    void Configure() {
+        m_algo = std::make_unique<AlgoT>(GetPrefix());
+        m_algo->level(static_cast<algorithms::LogLevel>(logger()->level()));
+        m_algo->applyConfig(config());
+        m_algo->init();
+    }
+
+    void ChangeRun(int64_t run_number) {
+    }
+
+    void Process(int64_t run_number, uint64_t event_number) {
+        m_algo->process({m_calo_hit_input()}, {m_proto_cluster_output().get()});
+    }
+
+};
+
+} // eicrecon
@@ -26,6 +26,7 @@ private:
 
     ParameterRef<int>   n_layer        {this, "numLayers",       config().n_layer         };
     ParameterRef<int>   layer_hits_max {this, "layerHitsMax",    config().layer_hits_max  };
+    ParameterRef<int>   road_layer_hits_max {this, "roadLayerHitsMax", config().road_layer_hits_max};
     ParameterRef<float> chi2_max       {this, "chi2Max",         config().chi2_max        };
 
   public:
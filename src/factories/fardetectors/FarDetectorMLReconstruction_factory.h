@@ -34,6 +34,8 @@ private:
 
     ParameterRef<std::string> m_modelPath       {this, "modelPath",       config().modelPath       };
     ParameterRef<std::string> m_methodName      {this, "methodName",      config().methodName      };
+    ParameterRef<std::string> m_backend         {this, "backend",         config().backend         };
+    ParameterRef<std::size_t> m_batchSize       {this, "batchSize",       config().batchSize       };
 
 
 public:
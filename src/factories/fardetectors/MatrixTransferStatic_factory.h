@@ -52,6 +52,7 @@ private:
     ParameterRef<double> hit2maxZ {this, "hit2maxZ", config().hit2maxZ};
 
     ParameterRef<std::string> readout {this, "readout", config().readout};
+    ParameterRef<std::string> matrixFile {this, "matrixFile", config().matrixFile};
 
     Service<AlgorithmsInit_service> m_algorithmsInit {this};
 
@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2024 EICrecon Authors
+
+#pragma once
+
+#include <JANA/JEvent.h>
+#include <edm4eic/MCRecoParticleAssociationCollection.h>
+#include <edm4hep/MCParticleCollection.h>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "algorithms/reco/BeamContext.h"
+#include "algorithms/reco/BeamContextBuilder.h"
+#include "extensions/jana/JOmniFactory.h"
+#include "services/algorithms_init/AlgorithmsInit_service.h"
+
+namespace eicrecon {
+
+class BeamContext_factory :
+        public JOmniFactory<BeamContext_factory> {
+
+public:
+    using AlgoT = eicrecon::BeamContextBuilder;
+private:
+    std::unique_ptr<AlgoT> m_algo;
+
+    PodioInput<edm4hep::MCParticle> m_mc_particles_input {this};
+    // Optional, the reconstructed scattered electron is only matched if given
+    VariadicPodioInput<edm4eic::MCRecoParticleAssociation> m_rc_particles_assoc_input {this};
+    Output<BeamContext> m_beam_context_output {this};
+
+    Service<AlgorithmsInit_service> m_algorithmsInit {this};
+
+public:
+    void Configure() {
+        m_algo = std::make_unique<AlgoT>(GetPrefix());
+        m_algo->level(static_cast<algorithms::LogLevel>(logger()->level()));
+        m_algo->init();
+    }
+
+    void ChangeRun(int64_t run_number) {
+    }
+
+    void Process(int64_t run_number, uint64_t event_number) {
+        auto context = std::make_unique<BeamContext>();
+        const auto rc_particles_assoc = m_rc_particles_assoc_input();
+        m_algo->process({m_mc_particles_input(), rc_particles_assoc.empty() ? nullptr : rc_particles_assoc.front()},
+                        {context.get()});
+        m_beam_context_output() = {context.release()};
+    }
+};
+
+} // eicrecon
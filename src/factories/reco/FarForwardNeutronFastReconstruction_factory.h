@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2024 Sebouh Paul, EICrecon Authors
+
+#pragma once
+
+#include "algorithms/reco/FarForwardNeutronFastReconstruction.h"
+#include "algorithms/reco/FarForwardNeutronReconstructionConfig.h"
+#include "services/algorithms_init/AlgorithmsInit_service.h"
+#include "extensions/jana/JOmniFactory.h"
+
+
+namespace eicrecon {
+
+  class FarForwardNeutronFastReconstruction_factory : public JOmniFactory<FarForwardNeutronFastReconstruction_factory,FarForwardNeutronReconstructionConfig> {
+
+   using AlgoT = eicrecon::FarForwardNeutronFastReconstruction;
+     private:
+         std::unique_ptr<AlgoT> m_algo;
+    PodioInput<edm4eic::CalorimeterHit> m_hits_hcal_input {this};
+    // Optional, an empty collection name leaves out the Ecal
+    PodioInput<edm4eic::CalorimeterHit> m_hits_ecal_input {this, "", true};
+    // Optional reference candidates (e.g. ReconstructedFarForwardZDCNeutrons) enable validation
+    VariadicPodioInput<edm4eic::ReconstructedParticle> m_reference_input {this};
+    PodioOutput<edm4eic::ReconstructedParticle> m_neutrons_output {this};
+    PodioOutput<edm4eic::Cluster> m_clusters_output {this};
+    ParameterRef<std::vector<double>> m_scale_corr_coeff_hcal     {this, "scale_corr_coeff_hcal",          config().scale_corr_coeff_hcal};
+    ParameterRef<std::vector<double>> m_scale_corr_coeff_ecal     {this, "scale_corr_coeff_ecal",          config().scale_corr_coeff_ecal};
+    ParameterRef<double>              m_hcal_sampling_fraction    {this, "hcal_sampling_fraction",         config().hcal_sampling_fraction};
+    ParameterRef<double>              m_min_hit_energy            {this, "min_hit_energy",                 config().min_hit_energy};
+    ParameterRef<double>              m_validation_tolerance      {this, "validation_tolerance",           config().validation_tolerance};
+    Service<AlgorithmsInit_service> m_algorithmsInit {this};
+
+public:
+    void Configure() {
+        m_algo = std::make_unique<AlgoT>(GetPrefix());
+        m_algo->level((algorithms::LogLevel)logger()->level());
+
+        m_algo->applyConfig(config());
+        m_algo->init();
+    }
+
+    void ChangeRun(int64_t run_number) {
+    }
+
+    void Process(int64_t run_number, uint64_t event_number) {
+      const auto reference = m_reference_input();
+      m_algo->process({m_hits_hcal_input(), m_hits_ecal_input(), reference.empty() ? nullptr : reference.front()},
+                      {m_neutrons_output().get(), m_clusters_output().get()});
+    }
+};
+
+} // eicrecon
@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2024 EICrecon Authors
+
+#pragma once
+
+#include <JANA/JEvent.h>
+#include <edm4eic/InclusiveKinematicsCollection.h>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "algorithms/reco/BeamContext.h"
+#include "algorithms/reco/FrameTransforms.h"
+#include "algorithms/reco/FrameTransformsBuilder.h"
+#include "extensions/jana/JOmniFactory.h"
+#include "services/algorithms_init/AlgorithmsInit_service.h"
+
+namespace eicrecon {
+
+class FrameTransforms_factory :
+        public JOmniFactory<FrameTransforms_factory> {
+
+public:
+    using AlgoT = eicrecon::FrameTransformsBuilder;
+private:
+    std::unique_ptr<AlgoT> m_algo;
+
+    Input<BeamContext> m_beam_context_input {this};
+    PodioInput<edm4eic::InclusiveKinematics> m_inclusive_kinematics_input {this};
+    Output<FrameTransforms> m_frame_transforms_output {this};
+
+    Service<AlgorithmsInit_service> m_algorithmsInit {this};
+
+public:
+    void Configure() {
+        m_algo = std::make_unique<AlgoT>(GetPrefix());
+        m_algo->level(static_cast<algorithms::LogLevel>(logger()->level()));
+        m_algo->init();
+    }
+
+    void ChangeRun(int64_t run_number) {
+    }
+
+    void Process(int64_t run_number, uint64_t event_number) {
+        auto transforms = std::make_unique<FrameTransforms>();
+        m_algo->process({m_beam_context_input().at(0), m_inclusive_kinematics_input()},
+                        {transforms.get()});
+        m_frame_transforms_output() = {transforms.release()};
+    }
+};
+
+} // eicrecon
@@ -10,6 +10,7 @@
 #include <utility>
 #include <vector>
 
+#include "algorithms/reco/BeamContext.h"
 #include "algorithms/reco/InclusiveKinematicsTruth.h"
 #include "extensions/jana/JOmniFactory.h"
 #include "services/algorithms_init/AlgorithmsInit_service.h"
@@ -24,7 +25,7 @@ public:
 private:
     std::unique_ptr<AlgoT> m_algo;
 
-    PodioInput<edm4hep::MCParticle> m_mc_particles_input {this};
+    Input<BeamContext> m_beam_context_input {this};
     PodioOutput<edm4eic::InclusiveKinematics> m_inclusive_kinematics_output {this};
 
     Service<AlgorithmsInit_service> m_algorithmsInit {this};
@@ -40,7 +41,7 @@ public:
     }
 
     void Process(int64_t run_number, uint64_t event_number) {
-        m_algo->process({m_mc_particles_input()}, {m_inclusive_kinematics_output().get()});
+        m_algo->process({m_beam_context_input().at(0)}, {m_inclusive_kinematics_output().get()});
     }
 };
 
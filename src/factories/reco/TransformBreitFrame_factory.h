@@ -4,14 +4,13 @@
 #pragma once
 
 #include <JANA/JEvent.h>
-#include <edm4hep/MCParticleCollection.h>
-#include <edm4eic/InclusiveKinematicsCollection.h>
 #include <edm4eic/ReconstructedParticleCollection.h>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "algorithms/reco/FrameTransforms.h"
 #include "algorithms/reco/TransformBreitFrame.h"
 #include "extensions/jana/JOmniFactory.h"
 #include "services/algorithms_init/AlgorithmsInit_service.h"
@@ -27,8 +26,7 @@ namespace eicrecon {
       std::unique_ptr<Algo> m_algo;
 
       // input collection
-      PodioInput<edm4hep::MCParticle> m_in_mcpart {this};
-      PodioInput<edm4eic::InclusiveKinematics> m_in_kine {this};
+      Input<FrameTransforms> m_in_transforms {this};
       PodioInput<edm4eic::ReconstructedParticle> m_in_part {this};
 
       // output collection
@@ -50,7 +48,7 @@ namespace eicrecon {
 
       void Process(int64_t run_number, int64_t event_number) {
         m_algo->process(
-          {m_in_mcpart(),m_in_kine(),m_in_part()},
+          {m_in_transforms().at(0),m_in_part()},
           {m_out_part().get()}
         );
       }
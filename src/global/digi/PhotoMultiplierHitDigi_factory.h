@@ -6,6 +6,7 @@
 #include <JANA/JEvent.h>
 #include <edm4eic/MCRecoTrackerHitAssociationCollection.h>
 #include <edm4eic/RawTrackerHitCollection.h>
+#include <edm4hep/EventHeaderCollection.h>
 #include <memory>
 #include <string>
 #include <utility>
@@ -32,11 +33,12 @@ public:
 private:
     std::unique_ptr<AlgoT> m_algo;
 
+    PodioInput<edm4hep::EventHeader> m_event_headers_input {this};
     PodioInput<edm4hep::SimTrackerHit> m_sim_hits_input {this};
     PodioOutput<edm4eic::RawTrackerHit> m_raw_hits_output {this};
     PodioOutput<edm4eic::MCRecoTrackerHitAssociation> m_raw_assocs_output {this};
 
-    ParameterRef<unsigned long> m_seed {this, "seed", config().seed, "random number generator seed"};
+    ParameterRef<unsigned long> m_seed {this, "seed", config().seed, "random number generator seed, combined with run and event number"};
     ParameterRef<double> m_hitTimeWindow {this, "hitTimeWindow", config().hitTimeWindow, ""};
     ParameterRef<double> m_timeResolution {this, "timeResolution", config().timeResolution, ""};
     ParameterRef<double> m_speMean {this, "speMean", config().speMean, ""};
@@ -60,9 +62,8 @@ public:
 
         // Initialize richgeo ReadoutGeo and set random CellID visitor lambda (if a RICH)
         if (GetPluginName() == "DRICH" || GetPluginName() == "PFRICH") {
-            m_RichGeoSvc().GetReadoutGeo(GetPluginName())->SetSeed(config().seed);
             m_algo->SetVisitRngCellIDs(
-                [this] (std::function<void(PhotoMultiplierHitDigi::CellIDType)> lambda, float p) { m_RichGeoSvc().GetReadoutGeo(GetPluginName())->VisitAllRngPixels(lambda, p); }
+                [this] (std::function<void(PhotoMultiplierHitDigi::CellIDType)> lambda, float p, std::function<double()> rng_uniform) { m_RichGeoSvc().GetReadoutGeo(GetPluginName())->VisitAllRngPixels(lambda, p, rng_uniform); }
                 );
             m_algo->SetPixelGapMask(
                 [this] (PhotoMultiplierHitDigi::CellIDType cellID, dd4hep::Position pos) { return m_RichGeoSvc().GetReadoutGeo(GetPluginName())->PixelGapMask(cellID, pos); }
@@ -77,7 +78,7 @@ public:
     }
 
     void Process(int64_t run_number, uint64_t event_number) {
-        m_algo->process({m_sim_hits_input()},
+        m_algo->process({m_event_headers_input(), m_sim_hits_input()},
                         {m_raw_hits_output().get(), m_raw_assocs_output().get()});
     }
 };
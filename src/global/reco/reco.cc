@@ -27,7 +27,10 @@
 #include "extensions/jana/JOmniFactoryGeneratorT.h"
 #include "factories/meta/CollectionCollector_factory.h"
 #include "factories/meta/FilterMatching_factory.h"
+#include "factories/reco/BeamContext_factory.h"
+#include "factories/reco/FarForwardNeutronFastReconstruction_factory.h"
 #include "factories/reco/FarForwardNeutronReconstruction_factory.h"
+#include "factories/reco/FrameTransforms_factory.h"
 #ifdef USE_ONNX
 #include "factories/reco/InclusiveKinematicsML_factory.h"
 #endif
@@ -108,10 +111,34 @@ void InitPlugin(JApplication *app) {
     ));
 
 
+    // Beams, boost and scattered electron, shared by all kinematics algorithms
+    app->Add(new JOmniFactoryGeneratorT<BeamContext_factory>(
+        "MCBeamContext",
+        {
+          "MCParticles"
+        },
+        {
+          "MCBeamContext"
+        },
+        app
+    ));
+
+    app->Add(new JOmniFactoryGeneratorT<BeamContext_factory>(
+        "BeamContext",
+        {
+          "MCParticles",
+          "ReconstructedParticleAssociations"
+        },
+        {
+          "BeamContext"
+        },
+        app
+    ));
+
     app->Add(new JOmniFactoryGeneratorT<InclusiveKinematicsTruth_factory>(
         "InclusiveKinematicsTruth",
         {
-          "MCParticles"
+          "MCBeamContext"
         },
         {
           "InclusiveKinematicsTruth"
@@ -123,7 +150,7 @@ void InitPlugin(JApplication *app) {
     app->Add(new JOmniFactoryGeneratorT<InclusiveKinematicsReconstructed_factory<InclusiveKinematicsElectron>>(
         "InclusiveKinematicsElectron",
         {
-          "MCParticles",
+          "BeamContext",
           "ScatteredElectronsTruth",
           "HadronicFinalState"
         },
@@ -136,7 +163,7 @@ void InitPlugin(JApplication *app) {
     app->Add(new JOmniFactoryGeneratorT<InclusiveKinematicsReconstructed_factory<InclusiveKinematicsJB>>(
         "InclusiveKinematicsJB",
         {
-          "MCParticles",
+          "BeamContext",
           "ScatteredElectronsTruth",
           "HadronicFinalState"
         },
@@ -149,7 +176,7 @@ void InitPlugin(JApplication *app) {
     app->Add(new JOmniFactoryGeneratorT<InclusiveKinematicsReconstructed_factory<InclusiveKinematicsDA>>(
         "InclusiveKinematicsDA",
         {
-          "MCParticles",
+          "BeamContext",
           "ScatteredElectronsTruth",
           "HadronicFinalState"
         },
@@ -162,7 +189,7 @@ void InitPlugin(JApplication *app) {
     app->Add(new JOmniFactoryGeneratorT<InclusiveKinematicsReconstructed_factory<InclusiveKinematicsESigma>>(
         "InclusiveKinematicsESigma",
         {
-          "MCParticles",
+          "BeamContext",
           "ScatteredElectronsTruth",
           "HadronicFinalState"
         },
@@ -188,7 +215,7 @@ void InitPlugin(JApplication *app) {
     app->Add(new JOmniFactoryGeneratorT<InclusiveKinematicsReconstructed_factory<InclusiveKinematicsSigma>>(
         "InclusiveKinematicsSigma",
         {
-          "MCParticles",
+          "BeamContext",
           "ScatteredElectronsTruth",
           "HadronicFinalState"
         },
@@ -300,9 +327,16 @@ void InitPlugin(JApplication *app) {
         app
     ));
 
+    app->Add(new JOmniFactoryGeneratorT<FrameTransforms_factory>(
+            "FrameTransforms",
+            {"BeamContext","InclusiveKinematicsElectron"},
+            {"FrameTransforms"},
+            app
+    ));
+
     app->Add(new JOmniFactoryGeneratorT<TransformBreitFrame_factory>(
             "ReconstructedBreitFrameParticles",
-            {"MCParticles","InclusiveKinematicsElectron","ReconstructedParticles"},
+            {"FrameTransforms","ReconstructedParticles"},
             {"ReconstructedBreitFrameParticles"},
             {},
             app
@@ -317,13 +351,26 @@ void InitPlugin(JApplication *app) {
           },
           app   // TODO: Remove me once fixed
     ));
+    // Hit-level fast path, set its InputTags to also include ReconstructedFarForwardZDCNeutrons
+    // to compare against the full clustering chain, or set the Ecal hits to "" to leave them out
+    app->Add(new JOmniFactoryGeneratorT<FarForwardNeutronFastReconstruction_factory>(
+           "ReconstructedFarForwardZDCNeutronsFast",
+           {"HcalFarForwardZDCRecHits","EcalFarForwardZDCRecHits"},  // edm4eic::CalorimeterHitCollection
+          {"ReconstructedFarForwardZDCNeutronsFast",          // edm4eic::ReconstrutedParticleCollection,
+           "ReconstructedFarForwardZDCNeutronsFastClusters"}, // edm4eic::ClusterCollection
+          {
+            .scale_corr_coeff_hcal={-0.0756, -1.91, 2.30},
+            .scale_corr_coeff_ecal={-0.352, -1.34, 1.61},
+            .hcal_sampling_fraction=0.0203,
+          },
+          app   // TODO: Remove me once fixed
+    ));
 #if EDM4EIC_VERSION_MAJOR >= 6
     app->Add(new JOmniFactoryGeneratorT<HadronicFinalState_factory<HadronicFinalState>>(
         "HadronicFinalState",
         {
-          "MCParticles",
-          "ReconstructedParticles",
-          "ReconstructedParticleAssociations"
+          "BeamContext",
+          "ReconstructedParticles"
         },
         {
           "HadronicFinalState"
@@ -334,7 +381,7 @@ void InitPlugin(JApplication *app) {
 
     app->Add(new JOmniFactoryGeneratorT<TransformBreitFrame_factory>(
             "GeneratedBreitFrameParticles",
-            {"MCParticles","InclusiveKinematicsElectron","GeneratedParticles"},
+            {"FrameTransforms","GeneratedParticles"},
             {"GeneratedBreitFrameParticles"},
             {},
             app
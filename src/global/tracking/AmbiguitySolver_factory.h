@@ -34,6 +34,9 @@ private:
   ParameterRef<std::size_t> m_nMeasurementsMin{
       this, "nMeasurementsMin", config().n_measurements_min,
       "Number of measurements required for further reconstruction"};
+  ParameterRef<bool> m_mergeTrajectories{
+      this, "mergeTrajectories", config().merge_trajectories,
+      "Emit resolved tracks as a single trajectory sharing the input multi-trajectory"};
 
 public:
   void Configure() {
@@ -13,12 +13,13 @@
 #include <vector>
 
 #include "algorithms/tracking/TrackProjector.h"
+#include "algorithms/tracking/TrackProjectorConfig.h"
 #include "extensions/jana/JOmniFactory.h"
 
 namespace eicrecon {
 
 class TrackProjector_factory :
-        public JOmniFactory<TrackProjector_factory> {
+        public JOmniFactory<TrackProjector_factory, TrackProjectorConfig> {
 
 private:
     using AlgoT = eicrecon::TrackProjector;
@@ -27,11 +28,15 @@ private:
     Input<ActsExamples::Trajectories> m_acts_trajectories_input {this};
     PodioOutput<edm4eic::TrackSegment> m_segments_output {this};
 
+    ParameterRef<bool> m_firstLastOnly {this, "firstLastOnly", config().firstLastOnly, "Only store the first and last state of each trajectory"};
+    ParameterRef<std::vector<int>> m_volumes {this, "volumes", config().volumes, "Only store states in these geometry volumes (empty: all)"};
+
     Service<ACTSGeo_service> m_ACTSGeoSvc {this};
 
 public:
     void Configure() {
         m_algo = std::make_unique<AlgoT>();
+        m_algo->applyConfig(config());
         m_algo->init(m_ACTSGeoSvc().actsGeoProvider(), logger());
     }
 
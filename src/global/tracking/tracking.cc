@@ -197,6 +197,10 @@ void InitPlugin(JApplication *app) {
              "CentralCKFSeededActsTracks",
              "CentralCKFSeededActsTrajectories",
         },
+        {
+             // only consumed by ActsToTracks, which iterates over all tips
+             .merge_trajectories = true,
+        },
         app
     ));
 
@@ -12,7 +12,10 @@
 #include <algorithms/service.h>
 #include <spdlog/common.h>
 #include <spdlog/logger.h>
+#include <string>
+#include <vector>
 
+#include "algorithms/interfaces/CellIDGeometrySvc.h"
 #include "algorithms/interfaces/ParticleSvc.h"
 #include "services/log/Log_service.h"
 #include "services/geometry/dd4hep/DD4hep_service.h"
@@ -23,7 +26,7 @@
 class AlgorithmsInit_service : public JService
 {
   public:
-    AlgorithmsInit_service(JApplication *app) { };
+    AlgorithmsInit_service(JApplication *app) : m_app(app) { };
     virtual ~AlgorithmsInit_service() { };
 
     void acquire_services(JServiceLocator *srv_locator) override {
@@ -43,6 +46,14 @@ class AlgorithmsInit_service : public JService
             g.init(const_cast<dd4hep::Detector*>(this->m_dd4hep_service->detector().get()));
         });
 
+        // Register a cell ID geometry table, built after algorithms::GeoSvc
+        std::vector<std::string> cellid_table_readouts;
+        m_app->SetDefaultParameter("dd4hep:cellid_table_readouts", cellid_table_readouts,
+                                   "Comma separated list of readouts for which cell positions are precomputed");
+        auto& cellIDGeometrySvc = eicrecon::CellIDGeometrySvc::instance();
+        serviceSvc.add<eicrecon::CellIDGeometrySvc>(&cellIDGeometrySvc);
+        cellIDGeometrySvc.setProperty("readouts", cellid_table_readouts);
+
         // Register Log_service as algorithms::LogSvc
         const algorithms::LogLevel level{
             static_cast<algorithms::LogLevel>(m_log->level())};
@@ -79,6 +90,7 @@ class AlgorithmsInit_service : public JService
 
   private:
     AlgorithmsInit_service() = default;
+    JApplication *m_app = nullptr;
     std::shared_ptr<Log_service> m_log_service;
     std::shared_ptr<DD4hep_service> m_dd4hep_service;
     std::shared_ptr<spdlog::logger> m_log;
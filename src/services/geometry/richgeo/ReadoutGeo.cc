@@ -30,14 +30,11 @@ richgeo::ReadoutGeo::ReadoutGeo(std::string detName_, gsl::not_null<const dd4hep
   // capitalize m_detName
   std::transform(m_detName.begin(), m_detName.end(), m_detName.begin(), ::toupper);
 
-  // random number generators
-  m_random.SetSeed(1); // default seed
-
   // default (empty) cellID looper
   m_loopCellIDs = [] (std::function<void(CellIDType)> lambda) { return; };
 
   // default (empty) cellID rng generator
-  m_rngCellIDs = [] (std::function<void(CellIDType)> lambda, float p) { return; };
+  m_rngCellIDs = [] (std::function<void(CellIDType)> lambda, float p, std::function<double()> rng_uniform) { return; };
 
   // common objects
   m_readoutCoder = m_det->readout(m_detName+"Hits").idSpec().decoder();
@@ -84,17 +81,17 @@ richgeo::ReadoutGeo::ReadoutGeo(std::string detName_, gsl::not_null<const dd4hep
     }; // end definition of m_loopCellIDs
 
     // define k random cell IDs generator
-    m_rngCellIDs = [this] (std::function<void(CellIDType)> lambda, float p) {
+    m_rngCellIDs = [this] (std::function<void(CellIDType)> lambda, float p, std::function<double()> rng_uniform) {
       m_log->trace("call RngReadoutPixels for systemID = {} = {}", m_systemID, m_detName);
 
       int k = p * m_num_sec * m_num_pdus * m_num_sipms_per_pdu * m_num_px * m_num_px;
 
       for (int i = 0; i < k; i++) {
-        int isec = m_random.Uniform(0., m_num_sec);
-        int ipdu = m_random.Uniform(0., m_num_pdus);
-        int isipm = m_random.Uniform(0., m_num_sipms_per_pdu);
-        int x = m_random.Uniform(0., m_num_px);
-        int y = m_random.Uniform(0., m_num_px);
+        int isec = rng_uniform() * m_num_sec;
+        int ipdu = rng_uniform() * m_num_pdus;
+        int isipm = rng_uniform() * m_num_sipms_per_pdu;
+        int x = rng_uniform() * m_num_px;
+        int y = rng_uniform() * m_num_px;
 
         auto cellID = cellIDEncoding(isec, ipdu, isipm, x, y);
 
@@ -102,6 +99,9 @@ richgeo::ReadoutGeo::ReadoutGeo(std::string detName_, gsl::not_null<const dd4hep
       }
     };
 
+    // cache the sensor frames for the pixel gap mask
+    CacheSensorFrames();
+
   }
 
   // pfRICH readout --------------------------------------------------------------------
@@ -115,29 +115,91 @@ richgeo::ReadoutGeo::ReadoutGeo(std::string detName_, gsl::not_null<const dd4hep
 }
 
 
+// cache the frame of each sensor, so `PixelGapMask` does not need DD4hep lookups per hit
+// FIXME: generalize; this assumes the segmentation is `CartesianGridXY`
+void richgeo::ReadoutGeo::CacheSensorFrames() {
+  m_index_x     = m_readoutCoder->index("x");
+  m_index_y     = m_readoutCoder->index("y");
+  m_sensor_mask = ~( (*m_readoutCoder)[m_index_x].mask() | (*m_readoutCoder)[m_index_y].mask() );
+
+  for(auto const& [deName, detSensor] : m_detRich.children()) {
+    if(deName.find("sensor_de_sec")==std::string::npos)
+      continue;
+
+    auto sensorID = detSensor.id();
+    auto ipdu     = m_readoutCoder->get(sensorID, "pdu");
+    auto isipm    = m_readoutCoder->get(sensorID, "sipm");
+    auto isec     = m_readoutCoder->get(sensorID, "sector");
+    auto cellID00 = cellIDEncoding(isec, ipdu, isipm, 0, 0);
+
+    // sensor origin and local axes, such that local = axis.Dot(global - origin);
+    // cf. `GetSensorLocalPosition`
+    auto context   = m_conv->findContext(cellID00);
+    const auto rot = context->toElement().GetRotationMatrix();
+    SensorFrame frame;
+    frame.origin = GetSensorGlobalPosition(context);
+    frame.axis_x = dd4hep::Direction(rot[0], rot[3], rot[6]);
+    frame.axis_y = dd4hep::Direction(rot[1], rot[4], rot[7]);
+
+    // pixel centers, in the local frame
+    auto pixel_local = [&] (int x, int y) {
+      auto id = cellIDEncoding(isec, ipdu, isipm, x, y);
+      return GetSensorLocalPosition(id, m_conv->position(id));
+    };
+    auto p00 = pixel_local(0, 0);
+    auto p10 = pixel_local(1, 0);
+    auto p01 = pixel_local(0, 1);
+    frame.pixel0[0] = p00.x() / dd4hep::mm;
+    frame.pixel0[1] = p00.y() / dd4hep::mm;
+    frame.step_x[0] = (p10.x() - p00.x()) / dd4hep::mm;
+    frame.step_x[1] = (p10.y() - p00.y()) / dd4hep::mm;
+    frame.step_y[0] = (p01.x() - p00.x()) / dd4hep::mm;
+    frame.step_y[1] = (p01.y() - p00.y()) / dd4hep::mm;
+
+    m_sensor_frames.emplace(cellID00 & m_sensor_mask, frame);
+  }
+  m_log->debug("cached frames of {} sensors for pixel gap masks", m_sensor_frames.size());
+}
+
+
 // pixel gap mask
 // FIXME: generalize; this assumes the segmentation is `CartesianGridXY`
-bool richgeo::ReadoutGeo::PixelGapMask(CellIDType cellID, dd4hep::Position pos_hit_global) {
-  auto pos_pixel_global = m_conv->position(cellID);
-  auto pos_pixel_local  = GetSensorLocalPosition(cellID, pos_pixel_global);
-  auto pos_hit_local    = GetSensorLocalPosition(cellID, pos_hit_global);
+bool richgeo::ReadoutGeo::PixelGapMask(CellIDType cellID, dd4hep::Position pos_hit_global) const {
+  auto it = m_sensor_frames.find(cellID & m_sensor_mask);
+  if(it == m_sensor_frames.end()) {
+    auto pos_pixel_global = m_conv->position(cellID);
+    auto pos_pixel_local  = GetSensorLocalPosition(cellID, pos_pixel_global);
+    auto pos_hit_local    = GetSensorLocalPosition(cellID, pos_hit_global);
+    return ! (
+        std::abs( pos_hit_local.x()/dd4hep::mm - pos_pixel_local.x()/dd4hep::mm ) > m_pixel_size/2 ||
+        std::abs( pos_hit_local.y()/dd4hep::mm - pos_pixel_local.y()/dd4hep::mm ) > m_pixel_size/2
+        );
+  }
+  const auto& frame = it->second;
+
+  // hit position in the sensor local frame
+  auto   d           = pos_hit_global - frame.origin;
+  double hit_local_x = frame.axis_x.Dot(d) / dd4hep::mm;
+  double hit_local_y = frame.axis_y.Dot(d) / dd4hep::mm;
+
+  // pixel center in the sensor local frame
+  auto   x             = static_cast<double>(m_readoutCoder->get(cellID, m_index_x));
+  auto   y             = static_cast<double>(m_readoutCoder->get(cellID, m_index_y));
+  double pixel_local_x = frame.pixel0[0] + x * frame.step_x[0] + y * frame.step_y[0];
+  double pixel_local_y = frame.pixel0[1] + x * frame.step_x[1] + y * frame.step_y[1];
+
   return ! (
-      std::abs( pos_hit_local.x()/dd4hep::mm - pos_pixel_local.x()/dd4hep::mm ) > m_pixel_size/2 ||
-      std::abs( pos_hit_local.y()/dd4hep::mm - pos_pixel_local.y()/dd4hep::mm ) > m_pixel_size/2
+      std::abs( hit_local_x - pixel_local_x ) > m_pixel_size/2 ||
+      std::abs( hit_local_y - pixel_local_y ) > m_pixel_size/2
       );
 }
 
 
-// transform global position `pos` to sensor `cellID` frame position
-// IMPORTANT NOTE: this has only been tested for the dRICH; if you use it, test it carefully...
-dd4hep::Position richgeo::ReadoutGeo::GetSensorLocalPosition(CellIDType cellID, dd4hep::Position pos) {
-
-  // get the VolumeManagerContext for this sensitive detector
-  auto context = m_conv->findContext(cellID);
+// global position of the sensor of a VolumeManagerContext
+dd4hep::Position richgeo::ReadoutGeo::GetSensorGlobalPosition(const dd4hep::VolumeManagerContext* context) const {
 
   // transformation vector buffers
   double xyz_l[3], xyz_e[3], xyz_g[3];
-  double pv_g[3], pv_l[3];
 
   // get sensor position w.r.t. its parent
   auto sensor_elem = context->element;
@@ -150,6 +212,23 @@ dd4hep::Position richgeo::ReadoutGeo::GetSensorLocalPosition(CellIDType cellID,
   elementToGlobal.LocalToMaster(xyz_e, xyz_g);
   dd4hep::Position pos_sensor;
   pos_sensor.SetCoordinates(xyz_g);
+  return pos_sensor;
+}
+
+
+// transform global position `pos` to sensor `cellID` frame position
+// IMPORTANT NOTE: this has only been tested for the dRICH; if you use it, test it carefully...
+dd4hep::Position richgeo::ReadoutGeo::GetSensorLocalPosition(CellIDType cellID, dd4hep::Position pos) const {
+
+  // get the VolumeManagerContext for this sensitive detector
+  auto context = m_conv->findContext(cellID);
+
+  // transformation vector buffers
+  double pv_g[3], pv_l[3];
+
+  // get sensor global position
+  const auto& volToElement = context->toElement();
+  auto pos_sensor = GetSensorGlobalPosition(context);
 
   // get the position vector of `pos` w.r.t. the sensor position `pos_sensor`
   dd4hep::Direction pos_pv = pos - pos_sensor;
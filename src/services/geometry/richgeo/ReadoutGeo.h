@@ -10,15 +10,17 @@
 // DD4Hep
 #include <DD4hep/Detector.h>
 #include <DD4hep/Objects.h>
+#include <DD4hep/VolumeManager.h>
 #include <DDRec/CellIDPositionConverter.h>
 #include <DDSegmentation/BitFieldCoder.h>
 #include <Parsers/Primitives.h>
-#include <TRandomGen.h>
 #include <spdlog/logger.h>
+#include <cstddef>
 #include <functional>
 #include <gsl/pointers>
 #include <memory>
 #include <string>
+#include <unordered_map>
 
 // local
 #include "RichGeo.h"
@@ -50,18 +52,17 @@ namespace richgeo {
       // loop over readout pixels, executing `lambda(cellID)` on each
       void VisitAllReadoutPixels(std::function<void(CellIDType)> lambda) { m_loopCellIDs(lambda); }
 
-      // generated k rng cell IDs, executing `lambda(cellID)` on each
-      void VisitAllRngPixels(std::function<void(CellIDType)> lambda, float p) { m_rngCellIDs(lambda, p); }
+      // generated k rng cell IDs, executing `lambda(cellID)` on each; `rng_uniform`
+      // returns uniform random numbers in [0,1), and is owned by the caller
+      void VisitAllRngPixels(std::function<void(CellIDType)> lambda, float p, std::function<double()> rng_uniform) { m_rngCellIDs(lambda, p, rng_uniform); }
 
-      // pixel gap mask
-      bool PixelGapMask(CellIDType cellID, dd4hep::Position pos_hit_global);
+      // pixel gap mask; uses the sensor frames cached at construction, and falls
+      // back to DD4hep transformations for sensors that are not cached
+      bool PixelGapMask(CellIDType cellID, dd4hep::Position pos_hit_global) const;
 
       // transform global position `pos` to sensor `id` frame position
       // IMPORTANT NOTE: this has only been tested for the dRICH; if you use it, test it carefully...
-      dd4hep::Position GetSensorLocalPosition(CellIDType id, dd4hep::Position pos);
-
-      // set RNG seed
-      void SetSeed(unsigned long seed) { m_random.SetSeed(seed); }
+      dd4hep::Position GetSensorLocalPosition(CellIDType id, dd4hep::Position pos) const;
 
     protected:
 
@@ -82,12 +83,28 @@ namespace richgeo {
       // local function to loop over cellIDs; defined in initialization and called by `VisitAllReadoutPixels`
       std::function< void(std::function<void(CellIDType)>) > m_loopCellIDs;
       // local function to generate rng cellIDs; defined in initialization and called by `VisitAllRngPixels`
-      std::function< void(std::function<void(CellIDType)>, float) > m_rngCellIDs;
-
-    private:
-
-      // random number generators
-      TRandomMixMax m_random;
+      std::function< void(std::function<void(CellIDType)>, float, std::function<double()>) > m_rngCellIDs;
+
+      // sensor frame, for transforming global positions to the sensor local (x,y)
+      // plane, and the local (x,y) of its pixel centers [mm]
+      struct SensorFrame {
+        dd4hep::Position  origin;     // global position of the sensor
+        dd4hep::Direction axis_x;     // global direction of the local x axis
+        dd4hep::Direction axis_y;     // global direction of the local y axis
+        double            pixel0[2];  // local (x,y) of pixel x=0,y=0
+        double            step_x[2];  // local (x,y) step between pixels along x
+        double            step_y[2];  // local (x,y) step between pixels along y
+      };
+      void CacheSensorFrames();
+
+      // global position of the sensor of a VolumeManagerContext
+      dd4hep::Position GetSensorGlobalPosition(const dd4hep::VolumeManagerContext* context) const;
+
+      // sensor frames, keyed by cellID with the pixel x and y fields cleared
+      std::unordered_map<CellIDType, SensorFrame> m_sensor_frames;
+      CellIDType  m_sensor_mask = 0;
+      std::size_t m_index_x = 0;
+      std::size_t m_index_y = 0;
 
   };
 }
@@ -0,0 +1,247 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2024 EICrecon Authors
+
+#include "BackgroundMixer.h"
+
+#include <JANA/JException.h>
+#include <edm4hep/CaloHitContributionCollection.h>
+#include <edm4hep/EDM4hepVersion.h>
+#include <edm4hep/EventHeaderCollection.h>
+#include <edm4hep/MCParticleCollection.h>
+#include <edm4hep/SimCalorimeterHitCollection.h>
+#include <edm4hep/SimTrackerHitCollection.h>
+#include <podio/CollectionBase.h>
+#include <podio/podioVersion.h>
+#include <optional>
+#include <random>
+#include <utility>
+
+namespace {
+
+    // SplitMix64 finalizer, to turn (seed, entry) into well separated seeds
+    std::uint64_t mix64(std::uint64_t x) {
+        x += 0x9e3779b97f4a7c15ULL;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+        return x ^ (x >> 31);
+    }
+
+    // Copy the frame parameters of one type
+    template <typename T>
+    void copy_parameters(const podio::Frame& from, podio::Frame& to) {
+        for (const auto& key : from.getParameterKeys<T>()) {
+#if podio_VERSION >= PODIO_VERSION(0, 99, 0)
+            if (auto value = from.getParameter<std::vector<T>>(key)) {
+                to.putParameter(key, std::move(*value));
+            }
+#else
+            to.putParameter(key, from.getParameter<std::vector<T>>(key));
+#endif
+        }
+    }
+
+}
+
+BackgroundMixer::BackgroundMixer(const std::vector<Source>& sources, std::uint64_t seed) : m_seed(seed) {
+    for (const auto& source : sources) {
+        SourceState state;
+        state.config = source;
+        state.reader = std::make_unique<podio::ROOTFrameReader>();
+        state.reader->openFile(source.filename);
+        state.entries = state.reader->getEntries("events");
+        if (state.entries == 0) {
+            throw JException("Background file \"%s\" contains no events", source.filename.c_str());
+        }
+        m_sources.push_back(std::move(state));
+    }
+}
+
+std::vector<std::string> BackgroundMixer::NamesOfKind(const std::vector<std::pair<const podio::Frame*, double>>& inputs, CollectionKind kind) {
+    std::vector<std::string> names;
+    std::set<std::string> seen;
+    for (const auto& [frame, time_offset] : inputs) {
+        for (const auto& name : frame->getAvailableCollections()) {
+            auto it = m_collection_kinds.find(name);
+            if (it == m_collection_kinds.end()) {
+                const auto* collection = frame->get(name);
+                auto collection_kind = CollectionKind::kOther;
+                if (dynamic_cast<const edm4hep::SimTrackerHitCollection*>(collection) != nullptr) {
+                    collection_kind = CollectionKind::kTrackerHits;
+                } else if (dynamic_cast<const edm4hep::SimCalorimeterHitCollection*>(collection) != nullptr) {
+                    collection_kind = CollectionKind::kCalorimeterHits;
+                }
+                it = m_collection_kinds.emplace(name, collection_kind).first;
+            }
+            if (it->second == kind && seen.insert(name).second) {
+                names.push_back(name);
+            }
+        }
+    }
+    return names;
+}
+
+std::unique_ptr<podio::Frame> BackgroundMixer::Mix(const podio::Frame& signal, size_t entry) {
+
+    // Seed from the input entry, so mixing is reproducible regardless of read order
+    std::mt19937_64 rng(mix64(mix64(m_seed) ^ entry));
+
+    // Read the background events for this signal event
+    std::vector<std::unique_ptr<podio::Frame>> frames;
+    std::vector<std::pair<const podio::Frame*, double>> backgrounds;
+    for (auto& source : m_sources) {
+        std::poisson_distribution<int> count_dist(source.config.rate);
+        std::uniform_int_distribution<size_t> entry_dist(0, source.entries - 1);
+        std::uniform_real_distribution<double> time_dist(0.0, source.config.time_window);
+        const int count = source.config.rate > 0 ? count_dist(rng) : 0;
+        for (int i = 0; i < count; ++i) {
+            const size_t entry = entry_dist(rng);
+            const double time_offset = source.config.time_window > 0 ? time_dist(rng) : 0.0;
+            frames.push_back(std::make_unique<podio::Frame>(source.reader->readEntry("events", entry)));
+            backgrounds.emplace_back(frames.back().get(), time_offset);
+        }
+    }
+
+    return Mix(signal, backgrounds);
+}
+
+std::unique_ptr<podio::Frame> BackgroundMixer::Mix(const podio::Frame& signal, const std::vector<std::pair<const podio::Frame*, double>>& backgrounds) {
+
+    std::vector<std::pair<const podio::Frame*, double>> inputs{{&signal, 0.0}};
+    inputs.insert(inputs.end(), backgrounds.begin(), backgrounds.end());
+    m_background_events_mixed += backgrounds.size();
+
+    auto mixed = std::make_unique<podio::Frame>();
+    std::set<std::string> carried{"EventHeader"};
+
+    edm4hep::EventHeaderCollection headers_out;
+    for (const auto& header : signal.get<edm4hep::EventHeaderCollection>("EventHeader")) {
+        headers_out.push_back(header.clone());
+    }
+    mixed->put(std::move(headers_out), "EventHeader");
+
+    copy_parameters<int>(signal, *mixed);
+    copy_parameters<float>(signal, *mixed);
+    copy_parameters<double>(signal, *mixed);
+    copy_parameters<std::string>(signal, *mixed);
+
+    // MCParticles: copy the particle data, then rebuild the parent/daughter
+    // relations within the merged collection
+    edm4hep::MCParticleCollection particles_out;
+    std::vector<size_t> particle_offset(inputs.size(), 0);
+    std::vector<size_t> particle_count(inputs.size(), 0);
+    std::vector<std::uint32_t> particle_collection_id(inputs.size(), 0);
+    for (size_t k = 0; k < inputs.size(); ++k) {
+        const auto& [frame, time_offset] = inputs[k];
+        particle_offset[k] = particles_out.size();
+        const auto* particles = dynamic_cast<const edm4hep::MCParticleCollection*>(frame->get("MCParticles"));
+        if (particles == nullptr) continue;
+        particle_count[k] = particles->size();
+        particle_collection_id[k] = particles->getID();
+        for (const auto& p : *particles) {
+            auto q = particles_out.create();
+            q.setPDG(p.getPDG());
+            q.setGeneratorStatus(p.getGeneratorStatus());
+            q.setSimulatorStatus(p.getSimulatorStatus());
+            q.setCharge(p.getCharge());
+            q.setTime(p.getTime() + time_offset);
+            q.setMass(p.getMass());
+            q.setVertex(p.getVertex());
+            q.setEndpoint(p.getEndpoint());
+            q.setMomentum(p.getMomentum());
+            q.setMomentumAtEndpoint(p.getMomentumAtEndpoint());
+#if EDM4HEP_BUILD_VERSION >= EDM4HEP_VERSION(0, 99, 0)
+            q.setHelicity(p.getHelicity());
+#else
+            q.setSpin(p.getSpin());
+            q.setColorFlow(p.getColorFlow());
+#endif
+        }
+        for (size_t i = 0; i < particles->size(); ++i) {
+            auto q = particles_out[particle_offset[k] + i];
+            for (const auto& parent : (*particles)[i].getParents()) {
+                q.addToParents(particles_out[particle_offset[k] + parent.getObjectID().index]);
+            }
+            for (const auto& daughter : (*particles)[i].getDaughters()) {
+                q.addToDaughters(particles_out[particle_offset[k] + daughter.getObjectID().index]);
+            }
+        }
+    }
+
+    // The merged particle for a particle of input k. An unset relation stays
+    // unset; nullopt means it points outside the MCParticles of input k.
+    auto remap = [&](size_t k, const edm4hep::MCParticle& p) -> std::optional<edm4hep::MCParticle> {
+        if (!p.isAvailable()) return p;
+        const auto id = p.getObjectID();
+        if (particle_count[k] == 0 || static_cast<std::uint32_t>(id.collectionID) != particle_collection_id[k]) return std::nullopt;
+        if (id.index < 0 || static_cast<size_t>(id.index) >= particle_count[k]) return std::nullopt;
+        return particles_out[particle_offset[k] + id.index];
+    };
+
+    // Tracker (and photo-sensor) hits
+    for (const auto& name : NamesOfKind(inputs, CollectionKind::kTrackerHits)) {
+        edm4hep::SimTrackerHitCollection hits_out;
+        for (size_t k = 0; k < inputs.size(); ++k) {
+            const auto& [frame, time_offset] = inputs[k];
+            const auto* hits = dynamic_cast<const edm4hep::SimTrackerHitCollection*>(frame->get(name));
+            if (hits == nullptr) continue;
+            for (const auto& hit : *hits) {
+                // The clone would keep a relation into the input frame
+                auto particle = remap(k, hit.getMCParticle());
+                if (!particle) {
+                    m_unmatched_hits_dropped++;
+                    continue;
+                }
+                auto out = hit.clone();
+                out.setTime(hit.getTime() + time_offset);
+                out.setMCParticle(*particle);
+                hits_out.push_back(out);
+            }
+        }
+        mixed->put(std::move(hits_out), name);
+        carried.insert(name);
+    }
+
+    // Calorimeter hits, with their contributions rebuilt in "<name>Contributions"
+    for (const auto& name : NamesOfKind(inputs, CollectionKind::kCalorimeterHits)) {
+        edm4hep::SimCalorimeterHitCollection hits_out;
+        edm4hep::CaloHitContributionCollection contributions_out;
+        for (size_t k = 0; k < inputs.size(); ++k) {
+            const auto& [frame, time_offset] = inputs[k];
+            const auto* hits = dynamic_cast<const edm4hep::SimCalorimeterHitCollection*>(frame->get(name));
+            if (hits == nullptr) continue;
+            for (const auto& hit : *hits) {
+                auto out = hits_out.create();
+                out.setCellID(hit.getCellID());
+                out.setEnergy(hit.getEnergy());
+                out.setPosition(hit.getPosition());
+                for (const auto& contribution : hit.getContributions()) {
+                    auto particle = remap(k, contribution.getParticle());
+                    if (!particle) {
+                        m_unmatched_hits_dropped++;
+                        continue;
+                    }
+                    auto contribution_out = contribution.clone();
+                    contribution_out.setTime(contribution.getTime() + time_offset);
+                    contribution_out.setParticle(*particle);
+                    contributions_out.push_back(contribution_out);
+                    out.addToContributions(contribution_out);
+                }
+            }
+        }
+        mixed->put(std::move(hits_out), name);
+        mixed->put(std::move(contributions_out), name + "Contributions");
+        carried.insert(name);
+        carried.insert(name + "Contributions");
+    }
+
+    mixed->put(std::move(particles_out), "MCParticles");
+    carried.insert("MCParticles");
+
+    for (const auto& name : signal.getAvailableCollections()) {
+        if (carried.count(name) == 0) {
+            m_dropped_collections.insert(name);
+        }
+    }
+
+    return mixed;
+}
@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2024 EICrecon Authors
+
+#pragma once
+
+#include <podio/Frame.h>
+#include <podio/ROOTFrameReader.h>
+#include <stddef.h>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * Overlays background events onto a signal frame.
+ *
+ * For every signal event, each background source contributes a Poisson
+ * distributed number of events, picked at random from its file and shifted
+ * by a random time offset. The random numbers are seeded from the entry
+ * index of the signal event in the (chained) input, which is unique even
+ * where event numbers repeat across files, so the result does not depend
+ * on the order in which events are read.
+ *
+ * The mixed frame contains the signal EventHeader and frame parameters, and
+ * MCParticles, SimTrackerHit and SimCalorimeterHit collections (with their
+ * "<name>Contributions") concatenated over signal and background. Relations
+ * to MCParticles are remapped into the merged MCParticles collection; hits
+ * and contributions whose MCParticle cannot be remapped are dropped.
+ * Collections of other types are not carried over.
+ */
+class BackgroundMixer {
+public:
+
+    struct Source {
+        std::string filename;
+        double rate;          // mean number of events per signal event
+        double time_window;   // time offsets are uniform in [0, time_window)
+    };
+
+    /// Opens the files of all sources. Without sources, only the overload
+    /// of Mix taking the background frames can add any background.
+    BackgroundMixer(const std::vector<Source>& sources, std::uint64_t seed);
+
+    /// \param signal  signal frame
+    /// \param entry   entry index of the signal frame in the input
+    std::unique_ptr<podio::Frame> Mix(const podio::Frame& signal, size_t entry);
+
+    /// Mix the given background frames into the signal frame
+    ///
+    /// \param signal       signal frame
+    /// \param backgrounds  background frames, each with its time offset
+    std::unique_ptr<podio::Frame> Mix(const podio::Frame& signal, const std::vector<std::pair<const podio::Frame*, double>>& backgrounds);
+
+    /// Names of signal collections that were not carried over so far
+    const std::set<std::string>& GetDroppedCollections() const { return m_dropped_collections; }
+
+    size_t GetBackgroundEventsMixed() const { return m_background_events_mixed; }
+
+    /// Number of hits and contributions dropped because their MCParticle could not be remapped
+    size_t GetUnmatchedHitsDropped() const { return m_unmatched_hits_dropped; }
+
+private:
+
+    struct SourceState {
+        Source config;
+        std::unique_ptr<podio::ROOTFrameReader> reader;
+        size_t entries = 0;
+    };
+
+    enum class CollectionKind { kTrackerHits, kCalorimeterHits, kOther };
+
+    /// Names of the collections of the given kind over all input frames, in
+    /// first-seen order. The kind of each name is looked up once, so that
+    /// collections that are not mixed are not unpacked for every event.
+    std::vector<std::string> NamesOfKind(const std::vector<std::pair<const podio::Frame*, double>>& inputs, CollectionKind kind);
+
+    std::vector<SourceState> m_sources;
+    std::uint64_t m_seed;
+    std::map<std::string, CollectionKind> m_collection_kinds;
+    std::set<std::string> m_dropped_collections;
+    size_t m_background_events_mixed = 0;
+    size_t m_unmatched_hits_dropped = 0;
+};
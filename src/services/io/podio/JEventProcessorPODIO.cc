@@ -348,6 +348,11 @@ JEventProcessorPODIO::JEventProcessorPODIO() {
             m_collections_to_print,
             "Comma separated list of collection names to print to screen, e.g. for debugging."
     );
+    japp->SetDefaultParameter(
+            "podio:parallel_factory_threads",
+            m_parallel_factory_threads,
+            "Number of threads used to run independent factories of one event concurrently before writing it (0 = lazy serial execution). Collections that fail are retried serially."
+    );
 
     m_output_collections = std::set<std::string>(output_collections.begin(),
                                                  output_collections.end());
@@ -366,6 +371,12 @@ void JEventProcessorPODIO::Init() {
 #else
     m_writer = std::make_unique<podio::ROOTFrameWriter>(m_output_file);
 #endif
+    if (m_parallel_factory_threads > 0) {
+        m_factory_graph = app->GetService<JOmniFactoryGraph>();
+        m_factory_graph->SetThreadCount(m_parallel_factory_threads);
+        m_log->info("Running independent factories on {} threads per event", m_parallel_factory_threads);
+    }
+
     // TODO: NWB: Verify that output file is writable NOW, rather than after event processing completes.
     //       I definitely don't trust PODIO to do this for me.
 
@@ -420,6 +431,18 @@ void JEventProcessorPODIO::FindCollectionsToWrite(const std::shared_ptr<const JE
 
 void JEventProcessorPODIO::Process(const std::shared_ptr<const JEvent> &event) {
 
+    // After the first event has fixed the collections to write, their factories are
+    // run concurrently outside of the writer lock, and the serial triggering below
+    // only finds them in the event
+    std::shared_ptr<const JOmniFactoryGraph::Plan> plan;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        plan = m_factory_plan;
+    }
+    if (plan != nullptr) {
+        m_factory_graph->Execute(*event, *plan);
+    }
+
     std::lock_guard<std::mutex> lock(m_mutex);
     if (m_is_first_event) {
         FindCollectionsToWrite(event);
@@ -529,6 +552,9 @@ void JEventProcessorPODIO::Process(const std::shared_ptr<const JEvent> &event) {
     }
     */
     m_writer->writeFrame(*frame, "events", m_collections_to_write);
+    if (m_is_first_event && m_factory_graph != nullptr) {
+        m_factory_plan = m_factory_graph->MakePlan(m_collections_to_write);
+    }
     m_is_first_event = false;
 
 }
@@ -16,6 +16,7 @@
 #include <string>
 #include <vector>
 
+#include "extensions/jana/JOmniFactoryGraph.h"
 
 class JEventProcessorPODIO : public JEventProcessor {
 
@@ -48,4 +49,8 @@ public:
     std::vector<std::string> m_collections_to_write;  // derived from above config. parameters
     std::vector<std::string> m_collections_to_print;
 
+    int m_parallel_factory_threads = 0;  // config. parameter
+    std::shared_ptr<JOmniFactoryGraph> m_factory_graph;
+    std::shared_ptr<const JOmniFactoryGraph::Plan> m_factory_plan;  // derived from m_collections_to_write
+
 };
@@ -11,6 +11,7 @@
 #include <JANA/JEvent.h>
 #include <JANA/JException.h>
 #include <JANA/JLogger.h>
+#include <JANA/Services/JParameterManager.h>
 #include <JANA/Utils/JTypeInfo.h>
 #include <TFile.h>
 #include <TObject.h>
@@ -20,16 +21,20 @@
 #include <podio/CollectionBase.h>
 #include <podio/Frame.h>
 #include <podio/podioVersion.h>
+#include <glob.h>
 #include <algorithm>
 #include <cstdlib>
 #include <exception>
 #include <filesystem>
+#include <fstream>
 #include <iostream>
 #include <map>
+#include <set>
 #include <utility>
 #include <vector>
 
 // These files are generated automatically by make_datamodel_glue.py
+#include "extensions/jana/JOmniFactoryGraph.h"
 #include "services/io/podio/datamodel_glue.h"
 #include "services/io/podio/datamodel_includes.h" // IWYU pragma: keep
 
@@ -80,6 +85,41 @@ JEventSourcePODIO::JEventSourcePODIO(std::string resource_name, JApplication* ap
             "set to true to recycle through events continuously"
             );
 
+    GetApplication()->SetDefaultParameter(
+            "podio:read_ahead",
+            m_read_ahead,
+            "Number of frames to read and unpack ahead on a background thread (0 to read on demand)"
+            );
+
+    std::vector<std::string> input_include_collections;
+    GetApplication()->SetDefaultParameter(
+            "podio:input_include_collections",
+            input_include_collections,
+            "Comma separated list of collection names to read from the input file (default is all)"
+            );
+    m_INPUT_INCLUDE_COLLECTIONS = std::set<std::string>(input_include_collections.begin(), input_include_collections.end());
+
+    std::vector<std::string> input_exclude_collections;
+    GetApplication()->SetDefaultParameter(
+            "podio:input_exclude_collections",
+            input_exclude_collections,
+            "Comma separated list of collection names not to read from the input file"
+            );
+    m_INPUT_EXCLUDE_COLLECTIONS = std::set<std::string>(input_exclude_collections.begin(), input_exclude_collections.end());
+
+    GetApplication()->SetDefaultParameter(
+            "podio:input_collections_from_output",
+            m_input_collections_from_output,
+            "Also read the input collections that the factories for podio:output_collections need. Only JOmniFactory "
+            "inputs are followed, so collections used by other factories or processors must be included explicitly."
+            );
+
+    GetApplication()->SetDefaultParameter(
+            "podio:validate_input_selection",
+            m_validate_input_selection,
+            "Compare the selected collections of the first entry with a full read of it and stop on any difference"
+            );
+
     bool print_type_table = false;
     GetApplication()->SetDefaultParameter(
             "podio:print_type_table",
@@ -87,30 +127,34 @@ JEventSourcePODIO::JEventSourcePODIO(std::string resource_name, JApplication* ap
             "Print list of collection names and their types"
             );
 
-    // Hopefully we won't need to reimplement background event merging. Using podio frames, it looks like we would
-    // have to do a deep copy of all data in order to insert it into the same frame, which would probably be
-    // quite inefficient.
-    /*
-    std::string background_filename;
+    // Background mixing: each file is overlaid with its own Poisson rate and time window
     GetApplication()->SetDefaultParameter(
-            "podio:background_filename",
-            background_filename,
-            "Name of file containing background events to merge in (default is not to merge any background)"
+            "podio:background_files",
+            m_background_files,
+            "Comma separated list of files with background events to overlay on every event (default is no mixing)"
             );
-
-    int num_background_events=1;
     GetApplication()->SetDefaultParameter(
-            "podio:num_background_events",
-            num_background_events,
-            "Number of background events to add to every primary event."
-    );
-    */
+            "podio:background_rates",
+            m_background_rates,
+            "Mean number of background events per event, one per background file"
+            );
+    GetApplication()->SetDefaultParameter(
+            "podio:background_time_windows",
+            m_background_time_windows,
+            "Background events are shifted by a time offset uniform in [0, window) [ns], one per background file (default 0)"
+            );
+    GetApplication()->SetDefaultParameter(
+            "podio:background_seed",
+            m_background_seed,
+            "Seed for background mixing, combined with the input entry index of each event"
+            );
 }
 
 //------------------------------------------------------------------------------
 // Destructor
 //------------------------------------------------------------------------------
 JEventSourcePODIO::~JEventSourcePODIO() {
+    StopReadAhead();
     LOG << "Closing Event Source for " << GetResourceName() << LOG_END;
 }
 
@@ -128,18 +172,25 @@ void JEventSourcePODIO::Open() {
     // Open primary events file
     try {
 
-        // Verify file exists
-        if( ! std::filesystem::exists(GetResourceName()) ){
-            // Here we go against the standard practice of throwing an error and print
-            // the message and exit immediately. This is because we want the last message
-            // on the screen to be that the file doesn't exist.
-            auto mess = fmt::format(fmt::emphasis::bold | fg(fmt::color::red),"ERROR: ");
-            mess += fmt::format(fmt::emphasis::bold, "file: {} does not exist!",  GetResourceName());
-            std::cerr << std::endl << std::endl << mess << std::endl << std::endl;
-            std::_Exit(EXIT_FAILURE);
+        // Verify files exist
+        m_input_files = ResolveInputFiles(GetResourceName());
+        if (m_input_files.empty()) {
+            m_input_files.push_back(GetResourceName());
+        }
+        for (const auto& filename : m_input_files) {
+            if( ! std::filesystem::exists(filename) ){
+                // Here we go against the standard practice of throwing an error and print
+                // the message and exit immediately. This is because we want the last message
+                // on the screen to be that the file doesn't exist.
+                auto mess = fmt::format(fmt::emphasis::bold | fg(fmt::color::red),"ERROR: ");
+                mess += fmt::format(fmt::emphasis::bold, "file: {} does not exist!",  filename);
+                std::cerr << std::endl << std::endl << mess << std::endl << std::endl;
+                std::_Exit(EXIT_FAILURE);
+            }
         }
 
-        m_reader.openFile( GetResourceName() );
+        // Multiple files are chained into one logical source with continuous entries
+        m_reader.openFiles( m_input_files );
 
         auto version = m_reader.currentFileVersion();
         bool version_mismatch = version.major > podio::version::build_version.major;
@@ -154,10 +205,27 @@ void JEventSourcePODIO::Open() {
         LOG << "PODIO version: file=" << version << " (executable=" << podio::version::build_version << ")" << LOG_END;
 
         Nevents_in_file = m_reader.getEntries("events");
-        LOG << "Opened PODIO Frame file \"" << GetResourceName() << "\" with " << Nevents_in_file << " events" << LOG_END;
+        LOG << "Opened PODIO Frame file \"" << GetResourceName() << "\" (" << m_input_files.size() << " file(s)) with " << Nevents_in_file << " events" << LOG_END;
 
         if( print_type_table ) PrintCollectionTypeTable();
 
+        if( !m_background_files.empty() ) {
+            if( m_background_rates.size() != m_background_files.size() ) {
+                throw JException("podio:background_rates needs one rate per background file");
+            }
+            if( !m_background_time_windows.empty() && m_background_time_windows.size() != m_background_files.size() ) {
+                throw JException("podio:background_time_windows needs one window per background file");
+            }
+            std::vector<BackgroundMixer::Source> sources;
+            for (size_t i = 0; i < m_background_files.size(); i++) {
+                double window = m_background_time_windows.empty() ? 0.0 : m_background_time_windows[i];
+                sources.push_back({m_background_files[i], m_background_rates[i], window});
+                LOG << "Mixing background from \"" << m_background_files[i] << "\" at " << m_background_rates[i]
+                    << " events per event within " << window << " ns" << LOG_END;
+            }
+            m_background_mixer = std::make_unique<BackgroundMixer>(sources, m_background_seed);
+        }
+
     }catch (std::exception &e ){
         LOG_ERROR(default_cerr_logger) << e.what() << LOG_END;
         throw JException( fmt::format( "Problem opening file \"{}\"", GetResourceName() ) );
@@ -173,11 +241,270 @@ void JEventSourcePODIO::Open() {
 /// \param event
 //------------------------------------------------------------------------------
 void JEventSourcePODIO::Close() {
+    StopReadAhead();
+    if( m_background_mixer ) {
+        LOG << "Mixed " << m_background_mixer->GetBackgroundEventsMixed() << " background events into " << Nevents_read << " events" << LOG_END;
+        if( m_background_mixer->GetUnmatchedHitsDropped() > 0 ) {
+            LOG << "Background mixing: dropped " << m_background_mixer->GetUnmatchedHitsDropped()
+                << " hits and contributions whose MCParticle could not be remapped" << LOG_END;
+        }
+        for (const auto& name : m_background_mixer->GetDroppedCollections()) {
+            LOG << "Background mixing: collection \"" << name << "\" was not carried over" << LOG_END;
+        }
+    }
     // m_reader.close();
     // TODO: ROOTFrameReader does not appear to have a close() method.
 }
 
 
+//------------------------------------------------------------------------------
+// SelectCollectionsToRead
+//
+/// Determine which collections to read from the include and exclude lists and,
+/// if enabled, from the inputs the factory graph needs for podio:output_collections.
+/// This runs on the first event, once all factories have registered with the graph.
+//------------------------------------------------------------------------------
+void JEventSourcePODIO::SelectCollectionsToRead() {
+
+    std::set<std::string> include = m_INPUT_INCLUDE_COLLECTIONS;
+
+    if( m_input_collections_from_output ) {
+        auto* param = GetApplication()->GetJParameterManager()->FindParameter("podio:output_collections");
+        if( param != nullptr ) {
+            std::vector<std::string> targets;
+            JParameterManager::Parse(param->GetValue(), targets);
+            auto plan = GetApplication()->GetService<JOmniFactoryGraph>()->MakePlan(targets);
+            include.insert(plan->external_inputs.begin(), plan->external_inputs.end());
+            include.insert(targets.begin(), targets.end());
+        }
+    }
+
+    m_read_selected_collections = !include.empty() || !m_INPUT_EXCLUDE_COLLECTIONS.empty();
+    if( !m_read_selected_collections ) return;
+
+    // The collection names are only known from an entry. Probe the first one
+    // with the reader itself, so that no background events are mixed in.
+    std::vector<std::string> available_collections;
+    std::unique_ptr<podio::Frame> probe;
+    if( Nevents_in_file > 0 ) {
+        probe = std::make_unique<podio::Frame>(m_reader.readEntry("events", 0));
+        available_collections = probe->getAvailableCollections();
+    }
+
+    // The graph only knows the collections that factories take as inputs, not
+    // the ones their objects relate to. Add the relation targets of the
+    // simulated hits, so that the contributions and particles are not unset.
+    if( m_input_collections_from_output && probe ) {
+        for (const auto& name : available_collections) {
+            if( include.count(name) == 0 ) continue;
+            if( probe->get(name)->getValueTypeName() == "edm4hep::SimCalorimeterHit" ) {
+                include.insert(name + "Contributions");
+            }
+        }
+        include.insert("MCParticles");
+    }
+
+    m_collections_to_read.clear();
+    for (const auto& name : available_collections) {
+        // The event header is always needed for the event and run numbers
+        if( name != "EventHeader" ) {
+            if( !include.empty() && include.count(name) == 0 ) continue;
+            if( m_INPUT_EXCLUDE_COLLECTIONS.count(name) != 0 ) continue;
+        }
+        m_collections_to_read.push_back(name);
+    }
+    m_collections_to_read_set = std::set<std::string>(m_collections_to_read.begin(), m_collections_to_read.end());
+
+    LOG << "Reading " << m_collections_to_read.size() << " of " << available_collections.size() << " collections" << LOG_END;
+
+    if( m_validate_input_selection && probe ) {
+        ValidateSelectedRead(*probe);
+    }
+}
+
+//------------------------------------------------------------------------------
+// ValidateSelectedRead
+//
+/// Read the first entry with only the selected collections and compare it with
+/// a full read of the same entry. Every selected collection must have the same
+/// size, and the relations of the simulated hits and particles must point to
+/// the same objects. This catches relation targets missing from the selection.
+///
+/// \param full  the first entry, read with all collections
+//------------------------------------------------------------------------------
+void JEventSourcePODIO::ValidateSelectedRead(const podio::Frame& full) {
+#if podio_VERSION >= PODIO_VERSION(1, 1, 0)
+    podio::Frame selected(m_reader.readEntry("events", 0, m_collections_to_read));
+
+    auto same_object = [](const auto& a, const auto& b) {
+        return a.isAvailable() == b.isAvailable() && (!a.isAvailable() || a.getObjectID() == b.getObjectID());
+    };
+
+    std::vector<std::string> mismatched;
+    for (const auto& name : m_collections_to_read) {
+        const auto* full_collection = full.get(name);
+        const auto* selected_collection = selected.get(name);
+        if( selected_collection == nullptr || selected_collection->size() != full_collection->size() ) {
+            mismatched.push_back(name);
+            continue;
+        }
+
+        bool same = true;
+        const auto type = full_collection->getValueTypeName();
+        if( type == "edm4hep::SimCalorimeterHit" ) {
+            const auto& a = full.get<edm4hep::SimCalorimeterHitCollection>(name);
+            const auto& b = selected.get<edm4hep::SimCalorimeterHitCollection>(name);
+            for (size_t i = 0; same && i < a.size(); i++) {
+                same = a[i].contributions_size() == b[i].contributions_size();
+                for (size_t j = 0; same && j < a[i].contributions_size(); j++) {
+                    same = same_object(a[i].getContributions(j), b[i].getContributions(j))
+                        && same_object(a[i].getContributions(j).getParticle(), b[i].getContributions(j).getParticle());
+                }
+            }
+        } else if( type == "edm4hep::SimTrackerHit" ) {
+            const auto& a = full.get<edm4hep::SimTrackerHitCollection>(name);
+            const auto& b = selected.get<edm4hep::SimTrackerHitCollection>(name);
+            for (size_t i = 0; same && i < a.size(); i++) {
+                same = same_object(a[i].getMCParticle(), b[i].getMCParticle());
+            }
+        } else if( type == "edm4hep::MCParticle" ) {
+            const auto& a = full.get<edm4hep::MCParticleCollection>(name);
+            const auto& b = selected.get<edm4hep::MCParticleCollection>(name);
+            for (size_t i = 0; same && i < a.size(); i++) {
+                same = a[i].parents_size() == b[i].parents_size() && a[i].daughters_size() == b[i].daughters_size();
+                for (size_t j = 0; same && j < a[i].parents_size(); j++) {
+                    same = same_object(a[i].getParents(j), b[i].getParents(j));
+                }
+                for (size_t j = 0; same && j < a[i].daughters_size(); j++) {
+                    same = same_object(a[i].getDaughters(j), b[i].getDaughters(j));
+                }
+            }
+        }
+        if( !same ) mismatched.push_back(name);
+    }
+
+    if( !mismatched.empty() ) {
+        std::string names;
+        for (const auto& name : mismatched) names += (names.empty() ? "" : ", ") + name;
+        throw JException("Selected read of %s differs from a full read in: %s", GetResourceName().c_str(), names.c_str());
+    }
+    LOG << "Selected read of the first entry matches a full read" << LOG_END;
+#else
+    (void) full;
+    LOG << "podio < 1.1 always reads all collections, nothing to validate" << LOG_END;
+#endif
+}
+
+//------------------------------------------------------------------------------
+// IsCollectionToRead
+//------------------------------------------------------------------------------
+bool JEventSourcePODIO::IsCollectionToRead(const std::string& name) const {
+    return !m_read_selected_collections || m_collections_to_read_set.count(name) != 0;
+}
+
+//------------------------------------------------------------------------------
+// ReadFrame
+//
+/// Read the given entry into a frame. If only some collections are selected,
+/// podio versions that support it only read and decompress those branches.
+/// With background mixing, the returned frame is the mixed one.
+///
+/// \param entry
+//------------------------------------------------------------------------------
+std::unique_ptr<podio::Frame> JEventSourcePODIO::ReadFrame(size_t entry) {
+    std::unique_ptr<podio::Frame> frame;
+#if podio_VERSION >= PODIO_VERSION(1, 1, 0)
+    if( m_read_selected_collections ) {
+        frame = std::make_unique<podio::Frame>(m_reader.readEntry("events", entry, m_collections_to_read));
+    } else
+#endif
+    {
+        auto frame_data = m_reader.readEntry("events", entry);
+        frame = std::make_unique<podio::Frame>(std::move(frame_data));
+    }
+
+    if( m_background_mixer ) {
+        frame = m_background_mixer->Mix(*frame, entry);
+    }
+    return frame;
+}
+
+
+//------------------------------------------------------------------------------
+// ReadAheadLoop
+//
+/// Body of the read-ahead thread. Reads frames in order and unpacks all of
+/// their collections, so that decompression and unpacking happen off the
+/// source lock, and pushes them to the queue until it is full.
+//------------------------------------------------------------------------------
+void JEventSourcePODIO::ReadAheadLoop() {
+    try {
+        size_t entry = 0;
+        while (true) {
+            if (entry >= Nevents_in_file) {
+                if (m_run_forever && Nevents_in_file > 0) {
+                    entry = 0;
+                } else {
+                    break;
+                }
+            }
+
+            auto frame = ReadFrame(entry++);
+            for (const std::string& coll_name : frame->getAvailableCollections()) {
+                if( !IsCollectionToRead(coll_name) ) continue;
+                frame->get(coll_name);
+            }
+
+            std::unique_lock<std::mutex> lock(m_queue_mutex);
+            m_queue_not_full.wait(lock, [this] { return m_read_ahead_stop || m_queue.size() < m_read_ahead; });
+            if (m_read_ahead_stop) {
+                return;
+            }
+            m_queue.push_back(std::move(frame));
+            m_queue_not_empty.notify_one();
+        }
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(m_queue_mutex);
+        m_read_ahead_error = std::current_exception();
+    }
+
+    std::lock_guard<std::mutex> lock(m_queue_mutex);
+    m_read_ahead_done = true;
+    m_queue_not_empty.notify_all();
+}
+
+
+//------------------------------------------------------------------------------
+// StopReadAhead
+//
+/// Stop and join the read-ahead thread, if any, and report queue statistics.
+//------------------------------------------------------------------------------
+void JEventSourcePODIO::StopReadAhead() {
+    if (!m_read_ahead_thread.joinable()) return;
+    {
+        std::lock_guard<std::mutex> lock(m_queue_mutex);
+        m_read_ahead_stop = true;
+        m_queue.clear();
+    }
+    m_queue_not_full.notify_all();
+    m_read_ahead_thread.join();
+
+    if (Nevents_read > 0) {
+        LOG << "Read-ahead queue: average depth " << static_cast<double>(m_queue_depth_sum) / Nevents_read
+            << " of " << m_read_ahead << ", empty on " << m_queue_empty_count << " of " << Nevents_read << " events" << LOG_END;
+    }
+}
+
+
+//------------------------------------------------------------------------------
+// GetReadAheadQueueDepth
+//------------------------------------------------------------------------------
+size_t JEventSourcePODIO::GetReadAheadQueueDepth() {
+    std::lock_guard<std::mutex> lock(m_queue_mutex);
+    return m_queue.size();
+}
+
+
 //------------------------------------------------------------------------------
 // GetEvent
 //
@@ -190,37 +517,74 @@ void JEventSourcePODIO::GetEvent(std::shared_ptr<JEvent> event) {
     /// Calls to GetEvent are synchronized with each other, which means they can
     /// read and write state on the JEventSource without causing race conditions.
 
-    // Check if we have exhausted events from file
-    if( Nevents_read >= Nevents_in_file ) {
-        if( m_run_forever ){
-            Nevents_read = 0;
-        }else{
-            // m_reader.close();
-            // TODO:: ROOTFrameReader does not appear to have a close() method.
+    if( !m_collections_selected ) {
+        SelectCollectionsToRead();
+        m_collections_selected = true;
+        if( m_read_ahead > 0 ) {
+            LOG << "Reading up to " << m_read_ahead << " frames ahead" << LOG_END;
+            m_read_ahead_thread = std::thread(&JEventSourcePODIO::ReadAheadLoop, this);
+        }
+    }
+
+    std::unique_ptr<podio::Frame> frame;
+
+    if( m_read_ahead > 0 ) {
+        std::unique_lock<std::mutex> lock(m_queue_mutex);
+        m_queue_depth_sum += m_queue.size();
+        if (m_queue.empty()) m_queue_empty_count++;
+        m_queue_not_empty.wait(lock, [this] { return !m_queue.empty() || m_read_ahead_done; });
+        if (m_queue.empty()) {
+            if (m_read_ahead_error) std::rethrow_exception(m_read_ahead_error);
             throw RETURN_STATUS::kNO_MORE_EVENTS;
         }
+        frame = std::move(m_queue.front());
+        m_queue.pop_front();
+        m_queue_not_full.notify_one();
+    } else {
+        // Check if we have exhausted events from file
+        if( Nevents_read >= Nevents_in_file ) {
+            if( m_run_forever ){
+                Nevents_read = 0;
+            }else{
+                // m_reader.close();
+                // TODO:: ROOTFrameReader does not appear to have a close() method.
+                throw RETURN_STATUS::kNO_MORE_EVENTS;
+            }
+        }
+        frame = ReadFrame(Nevents_read);
     }
 
-    auto frame_data = m_reader.readEntry("events", Nevents_read);
-    auto frame = std::make_unique<podio::Frame>(std::move(frame_data));
+    InsertFrame(*event, std::move(frame));
+    Nevents_read += 1;
+}
+
+//------------------------------------------------------------------------------
+// InsertFrame
+//
+/// Copy the objects of a frame into the given JEvent and hand the frame over to it.
+///
+/// \param event
+/// \param frame
+//------------------------------------------------------------------------------
+void JEventSourcePODIO::InsertFrame(JEvent& event, std::unique_ptr<podio::Frame> frame) {
 
     const auto& event_headers = frame->get<edm4hep::EventHeaderCollection>("EventHeader"); // TODO: What is the collection name?
     if (event_headers.size() != 1) {
         throw JException("Bad event headers: Entry %d contains %d items, but 1 expected.", Nevents_read, event_headers.size());
     }
-    event->SetEventNumber(event_headers[0].getEventNumber());
-    event->SetRunNumber(event_headers[0].getRunNumber());
+    event.SetEventNumber(event_headers[0].getEventNumber());
+    event.SetRunNumber(event_headers[0].getRunNumber());
 
     // Insert contents odf frame into JFactories
     VisitPodioCollection<InsertingVisitor> visit;
     for (const std::string& coll_name : frame->getAvailableCollections()) {
+        if( !IsCollectionToRead(coll_name) ) continue;
         const podio::CollectionBase* collection = frame->get(coll_name);
-        InsertingVisitor visitor(*event, coll_name);
+        InsertingVisitor visitor(event, coll_name);
         visit(visitor, *collection);
     }
 
-    event->Insert(frame.release()); // Transfer ownership from unique_ptr to JFactoryT<podio::Frame>
-    Nevents_read += 1;
+    event.Insert(frame.release()); // Transfer ownership from unique_ptr to JFactoryT<podio::Frame>
 }
 
 //------------------------------------------------------------------------------
@@ -250,11 +614,15 @@ double JEventSourceGeneratorT<JEventSourcePODIO>::CheckOpenable(std::string reso
     // PODIO Frame reader gets slightly higher precedence than PODIO Legacy reader, but only if the file
     // contains a 'podio_metadata' TTree. If the file doesn't exist, this will return 0. The "file not found"
     // error will hopefully be generated by the PODIO legacy reader instead.
-    if (resource_name.find(".root") == std::string::npos ) return 0.0;
+    // For file lists and globs, the first file decides for all of them
+    const auto files = JEventSourcePODIO::ResolveInputFiles(resource_name);
+    if (files.empty()) return 0.0;
+    const std::string& first_file = files.front();
+    if (first_file.find(".root") == std::string::npos ) return 0.0;
 
     // PODIO FrameReader segfaults on legacy input files, so we use ROOT to validate beforehand. Of course,
     // we can't validate if ROOT can't read the file.
-    std::unique_ptr<TFile> file = std::make_unique<TFile>(resource_name.c_str());
+    std::unique_ptr<TFile> file = std::make_unique<TFile>(first_file.c_str());
     if (!file || file->IsZombie()) return 0.0;
 
     // We test the format the same way that PODIO's python API does. See python/podio/reading.py
@@ -263,6 +631,46 @@ double JEventSourceGeneratorT<JEventSourcePODIO>::CheckOpenable(std::string reso
     return 0.03;
 }
 
+//------------------------------------------------------------------------------
+// ResolveInputFiles
+//
+/// A resource name ending in ".list" or ".txt" is read as a file list with one
+/// file per line (empty lines and lines starting with '#' are skipped). A name
+/// containing '*', '?' or '[' is expanded as a glob pattern, in sorted order.
+/// Anything else is returned as is.
+///
+/// \param resource_name  name given on the command line
+/// \return               list of files, empty if a list or pattern matched nothing
+//------------------------------------------------------------------------------
+std::vector<std::string> JEventSourcePODIO::ResolveInputFiles(const std::string& resource_name) {
+
+    std::vector<std::string> files;
+    const std::filesystem::path path(resource_name);
+
+    if (path.extension() == ".list" || path.extension() == ".txt") {
+        std::ifstream list(resource_name);
+        std::string line;
+        while (std::getline(list, line)) {
+            line.erase(0, line.find_first_not_of(" \t"));
+            line.erase(line.find_last_not_of(" \t\r") + 1);
+            if (line.empty() || line[0] == '#') continue;
+            files.push_back(line);
+        }
+    } else if (resource_name.find_first_of("*?[") != std::string::npos) {
+        glob_t matches;
+        if (glob(resource_name.c_str(), 0, nullptr, &matches) == 0) {
+            for (size_t i = 0; i < matches.gl_pathc; i++) {
+                files.emplace_back(matches.gl_pathv[i]);
+            }
+        }
+        globfree(&matches);
+    } else {
+        files.push_back(resource_name);
+    }
+
+    return files;
+}
+
 //------------------------------------------------------------------------------
 // PrintCollectionTypeTable
 //
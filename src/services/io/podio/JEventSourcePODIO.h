@@ -8,11 +8,21 @@
 #include <JANA/JEvent.h>
 #include <JANA/JEventSource.h>
 #include <JANA/JEventSourceGeneratorT.h>
+#include <podio/Frame.h>
 #include <podio/ROOTFrameReader.h>
 #include <stddef.h>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
+#include <thread>
+#include <vector>
+
+#include "BackgroundMixer.h"
 
 class JEventSourcePODIO : public JEventSource {
 
@@ -31,17 +41,60 @@ public:
 
     void PrintCollectionTypeTable(void);
 
+    /// Expand a resource name into the list of files to read: a single file, a
+    /// file list (*.list or *.txt, one file per line) or a glob pattern
+    static std::vector<std::string> ResolveInputFiles(const std::string& resource_name);
+
+    /// Number of frames currently waiting in the read-ahead queue
+    size_t GetReadAheadQueueDepth();
+
 protected:
+    void SelectCollectionsToRead();
+    void ValidateSelectedRead(const podio::Frame& full);
+    bool IsCollectionToRead(const std::string& name) const;
+    std::unique_ptr<podio::Frame> ReadFrame(size_t entry);
+    void InsertFrame(JEvent& event, std::unique_ptr<podio::Frame> frame);
+    void ReadAheadLoop();
+    void StopReadAhead();
+
     podio::ROOTFrameReader m_reader;
+    std::vector<std::string> m_input_files;
     size_t Nevents_in_file = 0;
     size_t Nevents_read = 0;
 
-    std::string m_include_collections_str;
-    std::string m_exclude_collections_str;
+    // Read-ahead: a background thread reads and unpacks the next frames into a
+    // bounded queue. The reader is only touched by that thread once it runs.
+    size_t m_read_ahead = 0;
+    std::thread m_read_ahead_thread;
+    std::mutex m_queue_mutex;
+    std::condition_variable m_queue_not_empty;
+    std::condition_variable m_queue_not_full;
+    std::deque<std::unique_ptr<podio::Frame>> m_queue;
+    bool m_read_ahead_done = false;
+    bool m_read_ahead_stop = false;
+    std::exception_ptr m_read_ahead_error;
+    size_t m_queue_depth_sum = 0;
+    size_t m_queue_empty_count = 0;
+
     std::set<std::string> m_INPUT_INCLUDE_COLLECTIONS;
     std::set<std::string> m_INPUT_EXCLUDE_COLLECTIONS;
+    bool m_input_collections_from_output = false;
+    bool m_validate_input_selection = false;
     bool m_run_forever=false;
 
+    // Background mixing
+    std::vector<std::string> m_background_files;
+    std::vector<double> m_background_rates;
+    std::vector<double> m_background_time_windows;
+    std::uint64_t m_background_seed = 1;
+    std::unique_ptr<BackgroundMixer> m_background_mixer;
+
+    // Collections to read from the input file (all if not selective)
+    std::vector<std::string> m_collections_to_read;
+    std::set<std::string> m_collections_to_read_set;
+    bool m_read_selected_collections = false;
+    bool m_collections_selected = false;
+
 };
 
 template <>
@@ -5,8 +5,10 @@
 
 #include <JANA/JApplication.h>
 #include <JANA/JEventSourceGeneratorT.h>
+#include <memory>
 
 #include "JEventProcessorPODIO.h"
+#include "extensions/jana/JOmniFactoryGraph.h"
 #include "JEventSourcePODIO.h"
 
 
@@ -14,6 +16,7 @@
 extern "C" {
 void InitPlugin(JApplication *app) {
     InitJANAPlugin(app);
+    app->ProvideService(std::make_shared<JOmniFactoryGraph>());
     app->Add(new JEventSourceGeneratorT<JEventSourcePODIO>());
 
     // Disable this behavior for now so one can run eicrecon with only the
@@ -0,0 +1,162 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2024 EICrecon Authors
+
+#include "services/onnx/ONNXInferenceSession.h"
+
+#include <fmt/core.h>
+#include <onnxruntime_c_api.h>
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+
+namespace eicrecon {
+
+  static std::string print_shape(const std::vector<std::int64_t>& v) {
+    std::stringstream ss("");
+    for (std::size_t i = 0; i < v.size() - 1; i++) ss << v[i] << "x";
+    ss << v[v.size() - 1];
+    return ss.str();
+  }
+
+  static std::size_t row_size(const std::vector<std::int64_t>& shape) {
+    if (std::any_of(std::next(shape.begin()), shape.end(), [](std::int64_t d) { return d < 0; })) {
+      throw std::runtime_error("only the first (batch) dimension may be dynamic");
+    }
+    return std::accumulate(std::next(shape.begin()), shape.end(), std::size_t{1}, std::multiplies<>());
+  }
+
+  ONNXInferenceSession::ONNXInferenceSession(Ort::Env& env, const std::string& model_path,
+                                             const Ort::SessionOptions& session_options, const Options& options)
+  : algorithms::LoggerMixin("ONNXInferenceSession"), m_options(options) {
+
+    m_session = Ort::Session(env, model_path.c_str(), session_options);
+    m_mem_info = Ort::MemoryInfo::CreateCpu(OrtAllocatorType::OrtArenaAllocator, OrtMemType::OrtMemTypeDefault);
+
+    if (m_session.GetInputCount() != 1 || m_session.GetOutputCount() != 1) {
+      throw std::runtime_error(fmt::format("model {} must have exactly one input and one output node", model_path));
+    }
+    if (m_session.GetInputTypeInfo(0).GetONNXType() != ONNX_TYPE_TENSOR
+     || m_session.GetOutputTypeInfo(0).GetONNXType() != ONNX_TYPE_TENSOR) {
+      throw std::runtime_error(fmt::format("model {} input and output nodes must be tensors", model_path));
+    }
+
+    Ort::AllocatorWithDefaultOptions allocator;
+    m_input_name   = m_session.GetInputNameAllocated(0, allocator).get();
+    m_output_name  = m_session.GetOutputNameAllocated(0, allocator).get();
+    m_input_shape  = m_session.GetInputTypeInfo(0).GetTensorTypeAndShapeInfo().GetShape();
+    m_output_shape = m_session.GetOutputTypeInfo(0).GetTensorTypeAndShapeInfo().GetShape();
+    debug("Input Node Name/Shape: {} : {}", m_input_name, print_shape(m_input_shape));
+    debug("Output Node Name/Shape: {} : {}", m_output_name, print_shape(m_output_shape));
+
+    m_input_row_size  = row_size(m_input_shape);
+    m_output_row_size = row_size(m_output_shape);
+
+    // Requests can only be merged when the model accepts any number of rows
+    m_batching = (m_input_shape.front() < 0) && (m_options.max_batch_rows > 1);
+  }
+
+  void ONNXInferenceSession::run(const float* input, std::size_t rows, float* output) const {
+
+    if (!m_batching) {
+      runDirect(input, rows, output);
+      return;
+    }
+
+    Request request{input, rows, output};
+
+    std::unique_lock<std::mutex> lock(m_queue_mutex);
+    m_pending.push_back(&request);
+    m_pending_rows += rows;
+
+    if (m_leader_active) {
+      // Another thread is collecting a batch, wait for it to evaluate ours
+      if (m_pending_rows >= m_options.max_batch_rows) {
+        m_leader_cv.notify_one();
+      }
+      m_done_cv.wait(lock, [&request] { return request.done; });
+    } else {
+      // Become the leader: give concurrent callers a short window to join
+      m_leader_active = true;
+      m_leader_cv.wait_for(lock, m_options.batch_timeout,
+                           [this] { return m_pending_rows >= m_options.max_batch_rows; });
+      std::vector<Request*> batch;
+      batch.swap(m_pending);
+      m_pending_rows  = 0;
+      m_leader_active = false;
+      lock.unlock();
+
+      runBatch(batch);
+
+      lock.lock();
+      for (auto* r : batch) {
+        r->done = true;
+      }
+      m_done_cv.notify_all();
+    }
+
+    if (request.error) {
+      std::rethrow_exception(request.error);
+    }
+  }
+
+  void ONNXInferenceSession::runDirect(const float* input, std::size_t rows, float* output) const {
+
+    std::vector<std::int64_t> input_shape  = m_input_shape;
+    std::vector<std::int64_t> output_shape = m_output_shape;
+    input_shape.front()  = static_cast<std::int64_t>(rows);
+    output_shape.front() = static_cast<std::int64_t>(rows);
+
+    // Bind the caller buffers directly, ONNX Runtime writes the result in place
+    auto input_tensor = Ort::Value::CreateTensor<float>(m_mem_info, const_cast<float*>(input), rows * m_input_row_size,
+                                                        input_shape.data(), input_shape.size());
+    auto output_tensor = Ort::Value::CreateTensor<float>(m_mem_info, output, rows * m_output_row_size,
+                                                         output_shape.data(), output_shape.size());
+
+    const std::array<const char*, 1> input_names{m_input_name.c_str()};
+    const std::array<const char*, 1> output_names{m_output_name.c_str()};
+    m_session.Run(Ort::RunOptions{nullptr}, input_names.data(), &input_tensor, 1, output_names.data(), &output_tensor, 1);
+  }
+
+  void ONNXInferenceSession::runBatch(const std::vector<Request*>& batch) const {
+
+    try {
+      if (batch.size() == 1) {
+        runDirect(batch.front()->input, batch.front()->rows, batch.front()->output);
+        return;
+      }
+
+      // Buffers are reused by whichever thread leads the batch
+      thread_local std::vector<float> inputs;
+      thread_local std::vector<float> outputs;
+
+      std::size_t rows = 0;
+      for (const auto* r : batch) {
+        rows += r->rows;
+      }
+      inputs.resize(rows * m_input_row_size);
+      outputs.resize(rows * m_output_row_size);
+
+      auto in = inputs.begin();
+      for (const auto* r : batch) {
+        in = std::copy_n(r->input, r->rows * m_input_row_size, in);
+      }
+
+      trace("Evaluating {} requests with {} rows in one batch", batch.size(), rows);
+      runDirect(inputs.data(), rows, outputs.data());
+
+      auto out = outputs.cbegin();
+      for (auto* r : batch) {
+        std::copy_n(out, r->rows * m_output_row_size, r->output);
+        out += r->rows * m_output_row_size;
+      }
+    } catch (...) {
+      for (auto* r : batch) {
+        r->error = std::current_exception();
+      }
+    }
+  }
+
+} // namespace eicrecon
@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2024 EICrecon Authors
+
+#pragma once
+
+#include <algorithms/logger.h>
+#include <onnxruntime_cxx_api.h>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace eicrecon {
+
+/**
+ * @brief A loaded ONNX model with one float input and one float output node,
+ * shared by all algorithms (and threads) that use the same model file.
+ *
+ * The first tensor dimension is treated as the batch (row) dimension. When
+ * that dimension is dynamic and micro-batching is enabled, concurrent `run()`
+ * calls from different threads are merged into a single inference: the first
+ * caller waits up to the batch timeout for others to join, evaluates the
+ * concatenated rows and hands every caller its own slice of the result.
+ */
+class ONNXInferenceSession : public algorithms::LoggerMixin {
+public:
+  struct Options {
+    std::size_t max_batch_rows{1};
+    std::chrono::microseconds batch_timeout{100};
+  };
+
+  ONNXInferenceSession(Ort::Env& env, const std::string& model_path,
+                       const Ort::SessionOptions& session_options, const Options& options);
+
+  /// Number of floats per row of the input and output tensors
+  std::size_t inputRowSize() const { return m_input_row_size; }
+  std::size_t outputRowSize() const { return m_output_row_size; }
+
+  /// Batch dimension of the model, -1 if dynamic
+  std::int64_t batchDimension() const { return m_input_shape.front(); }
+
+  /**
+   * @brief Evaluate `rows` rows of inputs, writing `rows` rows of outputs
+   *
+   * Both buffers are owned by the caller (typically reused per thread) and are
+   * bound directly to the input and output tensors, no copies are made unless
+   * the request is merged into a micro-batch. Throws Ort::Exception on failure.
+   */
+  void run(const float* input, std::size_t rows, float* output) const;
+
+private:
+  struct Request {
+    const float* input;
+    std::size_t rows;
+    float* output;
+    bool done{false};
+    std::exception_ptr error;
+  };
+
+  void runDirect(const float* input, std::size_t rows, float* output) const;
+  void runBatch(const std::vector<Request*>& batch) const;
+
+  mutable Ort::Session m_session{nullptr};
+  Ort::MemoryInfo m_mem_info{nullptr};
+
+  std::string m_input_name;
+  std::string m_output_name;
+  std::vector<std::int64_t> m_input_shape;
+  std::vector<std::int64_t> m_output_shape;
+  std::size_t m_input_row_size{1};
+  std::size_t m_output_row_size{1};
+
+  Options m_options;
+  bool m_batching{false};
+
+  // Micro-batching state
+  mutable std::mutex m_queue_mutex;
+  mutable std::condition_variable m_leader_cv;
+  mutable std::condition_variable m_done_cv;
+  mutable std::vector<Request*> m_pending;
+  mutable std::size_t m_pending_rows{0};
+  mutable bool m_leader_active{false};
+};
+
+} // namespace eicrecon
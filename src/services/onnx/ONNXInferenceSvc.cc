@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2024 EICrecon Authors
+
+#include "services/onnx/ONNXInferenceSvc.h"
+
+#include <onnxruntime_c_api.h>
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <utility>
+
+namespace eicrecon {
+
+  void ONNXInferenceSvc::init() {
+
+    m_env = std::make_unique<Ort::Env>(ORT_LOGGING_LEVEL_WARNING, "eicrecon");
+
+    m_session_options = Ort::SessionOptions();
+    m_session_options.SetIntraOpNumThreads(m_intra_op_num_threads);
+    m_session_options.SetInterOpNumThreads(m_inter_op_num_threads);
+
+    const std::string level = m_graph_optimization_level;
+    if (level == "disable") {
+      m_session_options.SetGraphOptimizationLevel(GraphOptimizationLevel::ORT_DISABLE_ALL);
+    } else if (level == "basic") {
+      m_session_options.SetGraphOptimizationLevel(GraphOptimizationLevel::ORT_ENABLE_BASIC);
+    } else if (level == "extended") {
+      m_session_options.SetGraphOptimizationLevel(GraphOptimizationLevel::ORT_ENABLE_EXTENDED);
+    } else {
+      if (level != "all") {
+        warning("Unknown graph optimization level \"{}\", using \"all\"", level);
+      }
+      m_session_options.SetGraphOptimizationLevel(GraphOptimizationLevel::ORT_ENABLE_ALL);
+    }
+
+    debug("Sessions use {} intra-op and {} inter-op threads, micro-batching up to {} rows",
+          m_intra_op_num_threads.value(), m_inter_op_num_threads.value(), m_max_batch_rows.value());
+  }
+
+  const ONNXInferenceSession* ONNXInferenceSvc::load(const std::string& model_path) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto pair = m_cache.find(model_path);
+    if (pair != m_cache.end()) {
+      return pair->second.get();
+    }
+
+    info("Loading ONNX model \"{}\"", model_path);
+    if (!std::filesystem::exists(model_path)) {
+      error("ONNX model \"{}\" not found", model_path);
+      return nullptr;
+    }
+
+    ONNXInferenceSession::Options options{
+      .max_batch_rows = static_cast<std::size_t>(std::max(1, m_max_batch_rows.value())),
+      .batch_timeout  = std::chrono::microseconds(m_batch_timeout_us.value()),
+    };
+    try {
+      auto session = std::make_unique<ONNXInferenceSession>(*m_env, model_path, m_session_options, options);
+      session->level(level());
+      auto result_ptr = session.get();
+      m_cache.insert({model_path, std::move(session)});
+      return result_ptr;
+    } catch (const std::exception& e) {
+      error("Failed to load ONNX model \"{}\": {}", model_path, e.what());
+      return nullptr;
+    }
+  }
+
+} // namespace eicrecon
@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2024 EICrecon Authors
+
+#pragma once
+
+#include <algorithms/logger.h>
+#include <algorithms/service.h>
+#include <onnxruntime_cxx_api.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "services/onnx/ONNXInferenceSession.h"
+
+namespace eicrecon {
+
+/**
+ * @brief Provides ONNX Runtime sessions shared between algorithms.
+ *
+ * Sessions are created on first request and cached by model path, so each
+ * model is loaded once per process regardless of how many algorithm instances
+ * use it. Thread pool sizes, graph optimization and micro-batching of
+ * concurrent requests are configured through the service properties, e.g.
+ * `-Ponnx:intra_op_num_threads=2`.
+ */
+class ONNXInferenceSvc : public algorithms::LoggedService<ONNXInferenceSvc> {
+public:
+  void init();
+
+  /// Returns the shared session for `model_path`, or nullptr if the model cannot be loaded
+  const ONNXInferenceSession* load(const std::string& model_path);
+
+private:
+  Property<int> m_intra_op_num_threads{this, "intraOpNumThreads", 1,
+      "Number of threads used to parallelize execution within nodes (0 = ONNX Runtime default)"};
+  Property<int> m_inter_op_num_threads{this, "interOpNumThreads", 1,
+      "Number of threads used to parallelize execution of the graph (0 = ONNX Runtime default)"};
+  Property<std::string> m_graph_optimization_level{this, "graphOptimizationLevel", "all",
+      "Graph optimization level: disable, basic, extended or all"};
+  Property<int> m_max_batch_rows{this, "maxBatchRows", 1,
+      "Maximum number of rows merged from concurrent requests into one inference (1 = no micro-batching)"};
+  Property<int> m_batch_timeout_us{this, "batchTimeoutMicroseconds", 100,
+      "Time a request waits for concurrent requests to join its batch"};
+
+  std::unique_ptr<Ort::Env> m_env;
+  Ort::SessionOptions m_session_options{nullptr};
+
+  std::mutex m_mutex;
+  std::map<std::string, std::unique_ptr<ONNXInferenceSession>> m_cache;
+
+  ALGORITHMS_DEFINE_LOGGED_SERVICE(ONNXInferenceSvc);
+};
+
+} // namespace eicrecon
@@ -0,0 +1,41 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2024 EICrecon Authors
+
+#include <JANA/JApplication.h>
+#include <algorithms/service.h>
+#include <string>
+
+#include "ONNXInferenceSvc.h"
+
+extern "C" {
+
+void InitPlugin(JApplication* app) {
+  InitJANAPlugin(app);
+
+  auto& serviceSvc = algorithms::ServiceSvc::instance();
+  auto& onnxSvc = eicrecon::ONNXInferenceSvc::instance();
+  serviceSvc.add<eicrecon::ONNXInferenceSvc>(&onnxSvc);
+
+  // Forward JANA parameters to the service properties
+  int intra_op_num_threads = 1;
+  int inter_op_num_threads = 1;
+  std::string graph_optimization_level = "all";
+  int max_batch_rows = 1;
+  int batch_timeout_us = 100;
+  app->SetDefaultParameter("onnx:intra_op_num_threads", intra_op_num_threads,
+                           "ONNX Runtime threads within a node (0 = runtime default)");
+  app->SetDefaultParameter("onnx:inter_op_num_threads", inter_op_num_threads,
+                           "ONNX Runtime threads across graph nodes (0 = runtime default)");
+  app->SetDefaultParameter("onnx:graph_optimization_level", graph_optimization_level,
+                           "ONNX Runtime graph optimization level: disable, basic, extended or all");
+  app->SetDefaultParameter("onnx:max_batch_rows", max_batch_rows,
+                           "Maximum rows merged from concurrent events into one inference (1 = no batching)");
+  app->SetDefaultParameter("onnx:batch_timeout_us", batch_timeout_us,
+                           "Microseconds an inference request waits for concurrent requests to join");
+  onnxSvc.setProperty("intraOpNumThreads", intra_op_num_threads);
+  onnxSvc.setProperty("interOpNumThreads", inter_op_num_threads);
+  onnxSvc.setProperty("graphOptimizationLevel", graph_optimization_level);
+  onnxSvc.setProperty("maxBatchRows", max_batch_rows);
+  onnxSvc.setProperty("batchTimeoutMicroseconds", batch_timeout_us);
+}
+}
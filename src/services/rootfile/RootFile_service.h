@@ -2,6 +2,7 @@
 
 
 #include <iostream>
+#include <memory>
 #include <vector>
 #include <string>
 #include <mutex>
@@ -13,6 +14,8 @@
 
 #include <TFile.h>
 
+#include "ThreadLocalHist.h"
+
 /**
  * This Service centralizes creation of a root file for histograms
  */
@@ -25,6 +28,7 @@ public:
     void acquire_services(JServiceLocator *locater) override {
         auto log_service = m_app->GetService<Log_service>();
         m_log = log_service->logger("RootFile");
+        m_root_lock = m_app->GetService<JGlobalRootLock>();
     }
 
     /// This will return a pointer to the top-level directory of the
@@ -56,6 +60,31 @@ public:
         return m_histfile;
     }
 
+    /// Wrap a histogram of the histogram file for filling from many threads
+    /// without the global root lock, see ThreadLocalHist. The per-thread
+    /// clones are merged into hist when the file is closed, or earlier with
+    /// MergeThreadLocalHists.
+    ///
+    /// \param hist histogram, already attached to its directory
+    /// \return per-thread fill buffers for hist
+    template <class T>
+    std::shared_ptr<ThreadLocalHist<T>> MakeThreadLocal(T* hist){
+        auto thread_local_hist = std::make_shared<ThreadLocalHist<T>>(hist, m_root_lock);
+        std::lock_guard<std::mutex> lock(m_thread_local_mutex);
+        m_thread_local_hists.push_back(thread_local_hist);
+        return thread_local_hist;
+    }
+
+    /// Merge all per-thread histogram clones into the histograms of the
+    /// file, e.g. before writing a checkpoint. The caller must hold the
+    /// global root lock, and no events may be in flight.
+    void MergeThreadLocalHists(){
+        std::lock_guard<std::mutex> lock(m_thread_local_mutex);
+        for (auto& thread_local_hist : m_thread_local_hists) {
+            thread_local_hist->Merge();
+        }
+    }
+
     /// Close the histogram file. If no histogram file was opened,
     /// then this does nothing.
     ///
@@ -65,12 +94,19 @@ public:
     /// the end of processing. This is only here for use in
     /// execptional circumstances like the program is suffering
     /// a fatal crash and we want to try and save the work by
-    /// closing the file cleanly.
+    /// closing the file cleanly. It acquires the global root lock,
+    /// so the caller must not hold it.
     void CloseHistFile(){
         if( m_histfile){
             std::string filename = m_histfile->GetName();
+            m_root_lock->acquire_write_lock();
+            MergeThreadLocalHists();
             m_histfile->Write();
             delete m_histfile;
+            m_root_lock->release_lock();
+            // The shared histograms were deleted with the file
+            std::lock_guard<std::mutex> lock(m_thread_local_mutex);
+            m_thread_local_hists.clear();
             m_log->info("Closed user histogram file: {}" , filename);
         }
         m_histfile = nullptr;
@@ -102,4 +138,7 @@ private:
     std::shared_ptr<spdlog::logger> m_log;
     TFile *m_histfile = nullptr;
     std::once_flag init_flag;
+    std::shared_ptr<JGlobalRootLock> m_root_lock;
+    std::mutex m_thread_local_mutex;
+    std::vector<std::shared_ptr<ThreadLocalHistBase>> m_thread_local_hists;
 };
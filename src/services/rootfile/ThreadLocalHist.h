@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2024 EICrecon Authors
+
+#pragma once
+
+#include <JANA/Services/JGlobalRootLock.h>
+#include <TDirectory.h>
+#include <TH1.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Common interface of ThreadLocalHist, so that RootFile_service can merge
+ * all of them regardless of the histogram type.
+ */
+class ThreadLocalHistBase {
+public:
+    virtual ~ThreadLocalHistBase() = default;
+
+    /// Add the contents of all per-thread clones to the shared histogram
+    /// and reset the clones. The caller must hold the global root lock,
+    /// and no thread may be filling at the same time (e.g. call it from
+    /// Finish or at the end of the run).
+    virtual void Merge() = 0;
+};
+
+/**
+ * Per-thread fill buffers for a histogram owned by the histogram file.
+ *
+ * Each thread fills its own detached clone of the shared histogram, obtained
+ * with local(), so that filling needs neither the global root lock nor any
+ * other synchronization. The clones are added to the shared histogram by
+ * Merge(). Create these with RootFile_service::MakeThreadLocal, which merges
+ * them when the histogram file is closed.
+ *
+ *    // Init
+ *    m_hist = rootfile_service->MakeThreadLocal(new TH1F(...));
+ *    // Process, any thread
+ *    m_hist->local()->Fill(x);
+ */
+template <class T>
+class ThreadLocalHist : public ThreadLocalHistBase {
+public:
+    ThreadLocalHist(T* shared, std::shared_ptr<JGlobalRootLock> root_lock)
+        : m_shared(shared), m_root_lock(std::move(root_lock)), m_id(next_id()) {}
+
+    /// The shared histogram, as written to the histogram file
+    T* shared() const { return m_shared; }
+
+    /// The calling thread's clone. Only the first call on each thread locks.
+    T* local() {
+        thread_local std::unordered_map<std::uint64_t, T*> t_clones;
+        auto& clone = t_clones[m_id];
+        if (clone == nullptr) {
+            clone = make_clone();
+        }
+        return clone;
+    }
+
+    void Merge() override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto& clone : m_clones) {
+            m_shared->Add(clone.get());
+            clone->Reset();
+        }
+    }
+
+private:
+    T* make_clone() {
+        // Creating ROOT objects is not thread safe. Merge takes m_mutex while
+        // its caller holds the root lock, so only take m_mutex after releasing it.
+        m_root_lock->acquire_write_lock();
+        T* clone = nullptr;
+        {
+            TDirectory::TContext context(nullptr);
+            clone = static_cast<T*>(m_shared->Clone());
+            clone->SetDirectory(nullptr);
+            clone->Reset();
+        }
+        m_root_lock->release_lock();
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_clones.emplace_back(clone);
+        return clone;
+    }
+
+    static std::uint64_t next_id() {
+        static std::atomic<std::uint64_t> id{0};
+        return id++;
+    }
+
+    T* m_shared;
+    std::shared_ptr<JGlobalRootLock> m_root_lock;
+    const std::uint64_t m_id;   // per-thread lookup key, never reused
+    std::mutex m_mutex;
+    std::vector<std::unique_ptr<T>> m_clones;
+};
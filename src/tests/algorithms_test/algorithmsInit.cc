@@ -8,6 +8,7 @@
 #include <algorithms/geo.h>
 #include <algorithms/random.h>
 #include <algorithms/service.h>
+#include <algorithms/interfaces/CellIDGeometrySvc.h>
 #include <algorithms/interfaces/ParticleSvc.h>
 #include <catch2/generators/catch_generators_random.hpp>
 #include <catch2/interfaces/catch_interfaces_reporter.hpp>
@@ -15,6 +16,9 @@
 #include <catch2/reporters/catch_reporter_registrars.hpp>
 #include <services/evaluator/EvaluatorSvc.h>
 #include <services/pid_lut/PIDLookupTableSvc.h>
+#ifdef USE_ONNX
+#include <services/onnx/ONNXInferenceSvc.h>
+#endif
 #include <stddef.h>
 #include <cstdint>
 #include <memory>
@@ -52,6 +56,9 @@ public:
       g.init(this->m_detector.get());
     });
 
+    auto& cellIDGeometrySvc = eicrecon::CellIDGeometrySvc::instance();
+    serviceSvc.add<eicrecon::CellIDGeometrySvc>(&cellIDGeometrySvc);
+
     [[maybe_unused]] auto& randomSvc = algorithms::RandomSvc::instance();
     auto seed = Catch::Generators::Detail::getSeed();
     serviceSvc.setInit<algorithms::RandomSvc>([seed](auto&& r) {
@@ -65,6 +72,11 @@ public:
     auto& lutSvc = eicrecon::PIDLookupTableSvc::instance();
     serviceSvc.add<eicrecon::PIDLookupTableSvc>(&lutSvc);
 
+#ifdef USE_ONNX
+    auto& onnxSvc = eicrecon::ONNXInferenceSvc::instance();
+    serviceSvc.add<eicrecon::ONNXInferenceSvc>(&onnxSvc);
+#endif
+
     auto& particleSvc = algorithms::ParticleSvc::instance();
     serviceSvc.add<algorithms::ParticleSvc>(&particleSvc);
 
@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2024 EICrecon Authors
+
+#include <DD4hep/Detector.h>
+#include <DD4hep/IDDescriptor.h>
+#include <DD4hep/Readout.h>
+#include <Evaluator/DD4hepUnits.h>
+#include <algorithms/geo.h>
+#include <catch2/catch_test_macros.hpp>
+#include <edm4eic/CalorimeterHitCollection.h>
+#include <edm4eic/ProtoClusterCollection.h>
+#include <edm4hep/Vector3f.h>
+#include <gsl/pointers>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include "algorithms/calorimetry/CalorimeterMACluster.h"
+#include "algorithms/calorimetry/CalorimeterMAClusterConfig.h"
+
+using eicrecon::CalorimeterMACluster;
+using eicrecon::CalorimeterMAClusterConfig;
+
+TEST_CASE( "the MA clustering algorithm runs", "[CalorimeterMACluster]" ) {
+  CalorimeterMACluster algo("CalorimeterMACluster");
+
+  CalorimeterMAClusterConfig cfg;
+  cfg.readout = "MockCalorimeterHits";
+  cfg.cellIndexX = "x";
+  cfg.cellIndexY = "y";
+  cfg.cellIndexZ = "layer";
+  cfg.minClusterSeedEdep = 100 * dd4hep::MeV;
+  cfg.minClusterHitEdep = 1 * dd4hep::MeV;
+  cfg.aggregationMargin = 0;
+  algo.applyConfig(cfg);
+  algo.init();
+
+  auto detector = algorithms::GeoSvc::instance().detector();
+  auto id_desc = detector->readout("MockCalorimeterHits").idSpec();
+
+  auto make_hits = [&id_desc](const std::vector<std::tuple<int, int, float>>& cells) {
+    edm4eic::CalorimeterHitCollection hits_coll;
+    for (const auto& [x, y, energy] : cells) {
+      hits_coll.create(
+        id_desc.encode({{"system", 255}, {"x", x}, {"y", y}}), // std::uint64_t cellID,
+        energy, // float energy,
+        0.0, // float energyError,
+        0.0, // float time,
+        0.0, // float timeError,
+        edm4hep::Vector3f(x, y, 0.0), // edm4hep::Vector3f position,
+        edm4hep::Vector3f(1.0, 1.0, 0.0), // edm4hep::Vector3f dimension,
+        0, // std::int32_t sector,
+        0, // std::int32_t layer,
+        edm4hep::Vector3f(x, y, 0.0) // edm4hep::Vector3f local
+      );
+    }
+    return hits_coll;
+  };
+
+  SECTION( "on neighbouring, corner and separated cells" ) {
+    auto hits_coll = make_hits({
+      {10, 10, 5.0},  // seed
+      {11, 10, 1.0},  // shares a face with the seed
+      {12, 11, 0.5},  // shares a corner with the previous one
+      {14, 10, 2.0},  // separated, second seed
+      {20, 20, 0.05}, // below the seed threshold
+    });
+    auto protoclust_coll = std::make_unique<edm4eic::ProtoClusterCollection>();
+    algo.process({&hits_coll}, {protoclust_coll.get()});
+
+    REQUIRE( (*protoclust_coll).size() == 2 );
+    REQUIRE( (*protoclust_coll)[0].hits_size() == 3 );
+    REQUIRE( (*protoclust_coll)[0].getHits(0).getEnergy() == 5.0 );
+    REQUIRE( (*protoclust_coll)[1].hits_size() == 1 );
+    REQUIRE( (*protoclust_coll)[1].getHits(0).getEnergy() == 2.0 );
+  }
+
+  SECTION( "separates clusters where the energy rises again" ) {
+    auto hits_coll = make_hits({
+      {10, 10, 5.0},
+      {11, 10, 1.0},
+      {12, 10, 3.0},
+    });
+    auto protoclust_coll = std::make_unique<edm4eic::ProtoClusterCollection>();
+    algo.process({&hits_coll}, {protoclust_coll.get()});
+
+    REQUIRE( (*protoclust_coll).size() == 2 );
+    REQUIRE( (*protoclust_coll)[0].hits_size() == 2 );
+    REQUIRE( (*protoclust_coll)[1].hits_size() == 1 );
+    REQUIRE( (*protoclust_coll)[1].getHits(0).getEnergy() == 3.0 );
+  }
+}
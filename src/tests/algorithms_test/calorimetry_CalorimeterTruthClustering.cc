@@ -0,0 +1,70 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2024 EICrecon Authors
+
+#include <algorithms/logger.h>
+#include <catch2/catch_test_macros.hpp>
+#include <edm4eic/CalorimeterHitCollection.h>
+#include <edm4eic/ProtoClusterCollection.h>
+#include <edm4hep/CaloHitContributionCollection.h>
+#include <edm4hep/MCParticleCollection.h>
+#include <edm4hep/SimCalorimeterHitCollection.h>
+#include <edm4hep/Vector3f.h>
+#include <cstdint>
+#include <memory>
+
+#include "algorithms/calorimetry/CalorimeterTruthClustering.h"
+
+using eicrecon::CalorimeterTruthClustering;
+
+TEST_CASE( "the truth clustering groups hits by MCParticle", "[CalorimeterTruthClustering]" ) {
+  CalorimeterTruthClustering algo("CalorimeterTruthClustering");
+  algo.level(algorithms::LogLevel::kInfo);
+  algo.init();
+
+  auto particles = std::make_unique<edm4hep::MCParticleCollection>();
+  auto tracked = particles->create();
+  // not in a collection, so without an index to group by
+  edm4hep::MutableMCParticle untracked;
+
+  auto contribs = std::make_unique<edm4hep::CaloHitContributionCollection>();
+  auto sim_hits = std::make_unique<edm4hep::SimCalorimeterHitCollection>();
+  auto hits = std::make_unique<edm4eic::CalorimeterHitCollection>();
+
+  // hits 0 and 2 from the tracked particle, 1 and 3 from the untracked one
+  for (std::uint64_t cellID = 0; cellID < 4; ++cellID) {
+    auto contrib = contribs->create();
+    if (cellID % 2 == 0) {
+      contrib.setParticle(tracked);
+    } else {
+      contrib.setParticle(untracked);
+    }
+    auto sim_hit = sim_hits->create();
+    sim_hit.setCellID(cellID);
+    sim_hit.addToContributions(contrib);
+
+    hits->create(
+      cellID, // std::uint64_t cellID,
+      1.0, // float energy,
+      0.0, // float energyError,
+      0.0, // float time,
+      0.0, // float timeError,
+      edm4hep::Vector3f(), // edm4hep::Vector3f position,
+      edm4hep::Vector3f(), // edm4hep::Vector3f dimension,
+      0, // std::int32_t sector,
+      0, // std::int32_t layer,
+      edm4hep::Vector3f() // edm4hep::Vector3f local
+    );
+  }
+
+  auto protoclusters = std::make_unique<edm4eic::ProtoClusterCollection>();
+  algo.process({hits.get(), sim_hits.get()}, {protoclusters.get()});
+
+  // one protocluster for the tracked particle, one shared by the untracked hits
+  REQUIRE( protoclusters->size() == 2 );
+  REQUIRE( (*protoclusters)[0].hits_size() == 2 );
+  REQUIRE( (*protoclusters)[0].getHits(0).getCellID() == 0 );
+  REQUIRE( (*protoclusters)[0].getHits(1).getCellID() == 2 );
+  REQUIRE( (*protoclusters)[1].hits_size() == 2 );
+  REQUIRE( (*protoclusters)[1].getHits(0).getCellID() == 1 );
+  REQUIRE( (*protoclusters)[1].getHits(1).getCellID() == 3 );
+}
@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2024 EICrecon Authors
+
+#include <algorithms/logger.h>
+#include <catch2/catch_test_macros.hpp>
+#include <edm4eic/ClusterCollection.h>
+#include <edm4eic/MCRecoClusterParticleAssociationCollection.h>
+#include <edm4hep/MCParticleCollection.h>
+#include <cmath>
+#include <memory>
+
+#include "algorithms/calorimetry/EnergyPositionClusterMerger.h"
+#include "algorithms/calorimetry/EnergyPositionClusterMergerConfig.h"
+
+using eicrecon::EnergyPositionClusterMerger;
+using eicrecon::EnergyPositionClusterMergerConfig;
+
+TEST_CASE( "the energy and position clusters are merged", "[EnergyPositionClusterMerger]" ) {
+  EnergyPositionClusterMerger algo("EnergyPositionClusterMerger");
+
+  EnergyPositionClusterMergerConfig cfg;
+  cfg.energyRelTolerance = 0.5;
+  cfg.phiTolerance       = 0.1;
+  cfg.etaTolerance       = 0.2;
+
+  algo.level(algorithms::LogLevel::kTrace);
+  algo.applyConfig(cfg);
+  algo.init();
+
+  edm4hep::MCParticleCollection mcparticles;
+  auto mcp1 = mcparticles.create();
+  auto mcp2 = mcparticles.create();
+
+  // position at radius 1 m, polar angle theta and azimuth phi
+  auto position = [](double theta, double phi) {
+    return edm4hep::Vector3f(1000 * std::sin(theta) * std::cos(phi),
+                             1000 * std::sin(theta) * std::sin(phi),
+                             1000 * std::cos(theta));
+  };
+
+  edm4eic::ClusterCollection energy_clus;
+  edm4eic::MCRecoClusterParticleAssociationCollection energy_assoc;
+  edm4eic::ClusterCollection pos_clus;
+  edm4eic::MCRecoClusterParticleAssociationCollection pos_assoc;
+
+  // energy clusters: far away in eta, close but worse energy, close and best energy
+  auto ec_far = energy_clus.create();
+  ec_far.setEnergy(5.0);
+  ec_far.setPosition(position(0.3, 0.0));
+  auto ec_worse = energy_clus.create();
+  ec_worse.setEnergy(3.0);
+  ec_worse.setPosition(position(M_PI / 2 + 0.05, 0.02));
+  auto ec_best = energy_clus.create();
+  ec_best.setEnergy(4.9);
+  ec_best.setPosition(position(M_PI / 2, 0.0));
+
+  auto ea = energy_assoc.create();
+  ea.setRec(ec_best);
+  ea.setSim(mcp1);
+  ea.setRecID(ec_best.getObjectID().index);
+  ea.setSimID(mcp1.getObjectID().index);
+
+  auto pc = pos_clus.create();
+  pc.setEnergy(5.0);
+  pc.setPosition(position(M_PI / 2, 0.01));
+  auto pc_unmatched = pos_clus.create();
+  pc_unmatched.setEnergy(5.0);
+  pc_unmatched.setPosition(position(M_PI / 2, M_PI));
+
+  auto pa = pos_assoc.create();
+  pa.setRec(pc);
+  pa.setSim(mcp2);
+  pa.setRecID(pc.getObjectID().index);
+  pa.setSimID(mcp2.getObjectID().index);
+
+  auto merged_clus  = std::make_unique<edm4eic::ClusterCollection>();
+  auto merged_assoc = std::make_unique<edm4eic::MCRecoClusterParticleAssociationCollection>();
+  algo.process({&energy_clus, &energy_assoc, &pos_clus, &pos_assoc}, {merged_clus.get(), merged_assoc.get()});
+
+  REQUIRE( merged_clus->size() == 1 );
+  REQUIRE( (*merged_clus)[0].getEnergy() == ec_best.getEnergy() );
+  REQUIRE( (*merged_clus)[0].getPosition().x == pc.getPosition().x );
+  REQUIRE( (*merged_clus)[0].getClusters(1) == ec_best );
+
+  // associations disagree on the MCParticle, so both are written with half weight
+  REQUIRE( merged_assoc->size() == 2 );
+  REQUIRE( (*merged_assoc)[0].getSim() == mcp1 );
+  REQUIRE( (*merged_assoc)[0].getWeight() == 0.5 );
+  REQUIRE( (*merged_assoc)[1].getSim() == mcp2 );
+  REQUIRE( (*merged_assoc)[1].getWeight() == 0.5 );
+}
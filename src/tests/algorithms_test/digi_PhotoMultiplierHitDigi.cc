@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2024 EICrecon Authors
+
+#include <algorithms/logger.h>
+#include <catch2/catch_test_macros.hpp>
+#include <edm4eic/MCRecoTrackerHitAssociationCollection.h>
+#include <edm4eic/RawTrackerHitCollection.h>
+#include <edm4hep/EventHeaderCollection.h>
+#include <edm4hep/SimTrackerHitCollection.h>
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "algorithms/digi/PhotoMultiplierHitDigi.h"
+#include "algorithms/digi/PhotoMultiplierHitDigiConfig.h"
+
+using eicrecon::PhotoMultiplierHitDigi;
+using eicrecon::PhotoMultiplierHitDigiConfig;
+
+namespace {
+
+  // digitize 200 photons at 3 eV, returning (cellID, charge, timeStamp) of the raw hits
+  std::vector<std::tuple<std::uint64_t, std::int32_t, std::int32_t>>
+  digitize(const std::string& name, std::int32_t run_number, std::uint64_t event_number) {
+    PhotoMultiplierHitDigi algo(name);
+    PhotoMultiplierHitDigiConfig cfg;
+    algo.level(algorithms::LogLevel::kInfo);
+    algo.applyConfig(cfg);
+    algo.init();
+
+    auto headers = std::make_unique<edm4hep::EventHeaderCollection>();
+    auto header = headers->create();
+    header.setRunNumber(run_number);
+    header.setEventNumber(event_number);
+
+    auto sim_hits = std::make_unique<edm4hep::SimTrackerHitCollection>();
+    for (std::uint64_t i = 0; i < 200; ++i) {
+      auto sim_hit = sim_hits->create();
+      sim_hit.setCellID(i);
+      sim_hit.setEDep(3e-9); // [GeV]
+      sim_hit.setTime(1.0);
+    }
+
+    auto raw_hits = std::make_unique<edm4eic::RawTrackerHitCollection>();
+    auto assocs = std::make_unique<edm4eic::MCRecoTrackerHitAssociationCollection>();
+    algo.process({headers.get(), sim_hits.get()}, {raw_hits.get(), assocs.get()});
+
+    std::vector<std::tuple<std::uint64_t, std::int32_t, std::int32_t>> result;
+    for (const auto& raw_hit : *raw_hits) {
+      result.emplace_back(raw_hit.getCellID(), raw_hit.getCharge(), raw_hit.getTimeStamp());
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+  }
+
+}
+
+TEST_CASE( "the photomultiplier digitization is reproducible per event", "[PhotoMultiplierHitDigi]" ) {
+
+  const auto reference = digitize("DRICHRawHits", 1, 42);
+
+  // with QE around 35%, a fraction of the photons is accepted
+  REQUIRE(!reference.empty());
+  REQUIRE(reference.size() < 200);
+
+  SECTION( "same detector, run and event" ) {
+    REQUIRE(digitize("DRICHRawHits", 1, 42) == reference);
+  }
+
+  SECTION( "different event" ) {
+    REQUIRE(digitize("DRICHRawHits", 1, 43) != reference);
+  }
+
+  SECTION( "different run" ) {
+    REQUIRE(digitize("DRICHRawHits", 2, 42) != reference);
+  }
+
+  SECTION( "different detector" ) {
+    REQUIRE(digitize("RICHEndcapNRawHits", 1, 42) != reference);
+  }
+
+}
+
+TEST_CASE( "the photomultiplier digitization applies the quantum efficiency", "[PhotoMultiplierHitDigi]" ) {
+  PhotoMultiplierHitDigi algo("PhotoMultiplierHitDigi");
+  PhotoMultiplierHitDigiConfig cfg;
+  cfg.quantumEfficiency = {{325, 1.00}, {900, 1.00}}; // unit QE, from about 1.38 to 3.81 eV
+  algo.level(algorithms::LogLevel::kInfo);
+  algo.applyConfig(cfg);
+  algo.init();
+
+  auto headers = std::make_unique<edm4hep::EventHeaderCollection>();
+  headers->create();
+
+  // photon energy [eV] and whether it is within the QE range
+  const std::vector<std::pair<double, bool>> photons = {
+    {1.0, false}, {1.5, true}, {2.0, true}, {3.0, true}, {3.7, true}, {4.0, false}, {-1.0, false}
+  };
+  auto sim_hits = std::make_unique<edm4hep::SimTrackerHitCollection>();
+  for (std::uint64_t i = 0; i < photons.size(); ++i) {
+    auto sim_hit = sim_hits->create();
+    sim_hit.setCellID(i);
+    sim_hit.setEDep(photons[i].first * 1e-9); // [GeV]
+  }
+
+  auto raw_hits = std::make_unique<edm4eic::RawTrackerHitCollection>();
+  auto assocs = std::make_unique<edm4eic::MCRecoTrackerHitAssociationCollection>();
+  algo.process({headers.get(), sim_hits.get()}, {raw_hits.get(), assocs.get()});
+
+  std::vector<std::uint64_t> accepted;
+  for (const auto& raw_hit : *raw_hits) {
+    accepted.push_back(raw_hit.getCellID());
+  }
+  std::sort(accepted.begin(), accepted.end());
+
+  std::vector<std::uint64_t> expected;
+  for (std::uint64_t i = 0; i < photons.size(); ++i) {
+    if (photons[i].second) {
+      expected.push_back(i);
+    }
+  }
+  REQUIRE(accepted == expected);
+}
@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2024 EICrecon Authors
+
+#include <algorithms/logger.h>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <edm4eic/TrackSegmentCollection.h>
+#include <edm4hep/TrackerHitCollection.h>
+#include <edm4hep/Vector3d.h>
+#include <gsl/pointers>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "algorithms/fardetectors/FarDetectorLinearTracking.h"
+#include "algorithms/fardetectors/FarDetectorLinearTrackingConfig.h"
+
+using Catch::Matchers::WithinAbs;
+
+TEST_CASE("the linear tracking finds a track among noise hits", "[FarDetectorLinearTracking]") {
+  eicrecon::FarDetectorLinearTracking algo("FarDetectorLinearTracking");
+
+  // Test both the fixed size (4 layer) and the dynamic size fit
+  int n_layer = GENERATE(3, 4);
+
+  eicrecon::FarDetectorLinearTrackingConfig cfg;
+  cfg.n_layer              = n_layer;
+  cfg.layer_hits_max       = 100;
+  cfg.road_layer_hits_max  = 1000;
+  cfg.chi2_max             = 0.001;
+  cfg.restrict_direction   = true;
+  cfg.optimum_theta        = 0;
+  cfg.optimum_phi          = 0;
+  cfg.step_angle_tolerance = 0.05;
+
+  algo.applyConfig(cfg);
+  algo.level(algorithms::LogLevel::kInfo);
+  algo.init();
+
+  // One straight track along z at x=y=10 plus more noise hits per layer than layer_hits_max,
+  // but fewer than road_layer_hits_max
+  std::mt19937 rng(1);
+  std::uniform_real_distribution<double> noise(-50., 50.);
+  std::vector<std::unique_ptr<edm4hep::TrackerHitCollection>> layer_hits;
+  std::vector<gsl::not_null<const edm4hep::TrackerHitCollection*>> inputs;
+  for (int layer = 0; layer < n_layer; layer++) {
+    auto hits = std::make_unique<edm4hep::TrackerHitCollection>();
+    double z = 100. * layer;
+    for (std::size_t i = 0; i < 200; i++) {
+      hits->create().setPosition(edm4hep::Vector3d(noise(rng), noise(rng), z));
+    }
+    hits->create().setPosition(edm4hep::Vector3d(10., 10., z));
+    inputs.emplace_back(hits.get());
+    layer_hits.push_back(std::move(hits));
+  }
+
+  auto segments = std::make_unique<edm4eic::TrackSegmentCollection>();
+  algo.process(inputs, {segments.get()});
+
+  REQUIRE(segments->size() == 1);
+  auto point = (*segments)[0].getPoints(0);
+  REQUIRE_THAT(point.position.x, WithinAbs(10., 1e-3));
+  REQUIRE_THAT(point.position.y, WithinAbs(10., 1e-3));
+  REQUIRE_THAT(point.position.z, WithinAbs(50. * (n_layer - 1), 1e-3));
+  REQUIRE_THAT(point.theta, WithinAbs(M_PI, 1e-3));
+}
+
+TEST_CASE("the linear tracking skips events with too many hits in a layer", "[FarDetectorLinearTracking]") {
+  eicrecon::FarDetectorLinearTracking algo("FarDetectorLinearTracking");
+
+  eicrecon::FarDetectorLinearTrackingConfig cfg;
+  cfg.n_layer             = 4;
+  cfg.layer_hits_max      = 2;
+  cfg.road_layer_hits_max = 5;
+  cfg.optimum_theta       = 0;
+  cfg.optimum_phi         = 0;
+  // The road search has its own, larger, cap
+  cfg.restrict_direction  = GENERATE(true, false);
+
+  algo.applyConfig(cfg);
+  algo.level(algorithms::LogLevel::kInfo);
+  algo.init();
+
+  // One straight track along z, with 6 hits in the last layer
+  std::vector<std::unique_ptr<edm4hep::TrackerHitCollection>> layer_hits;
+  std::vector<gsl::not_null<const edm4hep::TrackerHitCollection*>> inputs;
+  for (int layer = 0; layer < cfg.n_layer; layer++) {
+    auto hits = std::make_unique<edm4hep::TrackerHitCollection>();
+    double z = 100. * layer;
+    hits->create().setPosition(edm4hep::Vector3d(10., 10., z));
+    if (layer == cfg.n_layer - 1) {
+      for (std::size_t i = 0; i < 5; i++) {
+        hits->create().setPosition(edm4hep::Vector3d(-40. - 10. * i, 40., z));
+      }
+    }
+    inputs.emplace_back(hits.get());
+    layer_hits.push_back(std::move(hits));
+  }
+
+  auto segments = std::make_unique<edm4eic::TrackSegmentCollection>();
+  algo.process(inputs, {segments.get()});
+
+  REQUIRE(segments->empty());
+}
@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2024 EICrecon Authors
+
+#include <algorithms/logger.h>
+#include <catch2/catch_test_macros.hpp>
+#include <edm4eic/Cov6f.h>
+#include <edm4eic/TrackCollection.h>
+#include <edm4eic/TrackParametersCollection.h>
+#include <edm4eic/TrajectoryCollection.h>
+#include <edm4hep/MCParticleCollection.h>
+#include <edm4hep/Vector2f.h>
+#include <fmt/core.h>
+#include <spdlog/common.h>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "algorithms/fardetectors/FarDetectorMLReconstruction.h"
+#include "algorithms/fardetectors/FarDetectorMLReconstructionConfig.h"
+
+using eicrecon::FarDetectorMLReconstruction;
+using eicrecon::FarDetectorMLReconstructionConfig;
+
+// Throughput benchmark, hidden by default since it needs the LowQ2 network weights.
+// Run with: algorithms_test "[FarDetectorMLReconstruction]" from a directory containing calibrations/,
+// or point FARDETECTORML_MODEL (and FARDETECTORML_BACKEND) to another model.
+TEST_CASE( "batched inference throughput", "[.][benchmark][FarDetectorMLReconstruction]" ) {
+
+  FarDetectorMLReconstructionConfig cfg {
+    .modelPath  = "calibrations/tmva/LowQ2_DNN_CPU.weights.xml",
+    .methodName = "DNN_CPU",
+  };
+  if (const char* model = std::getenv("FARDETECTORML_MODEL")) {
+    cfg.modelPath = model;
+  }
+  if (const char* backend = std::getenv("FARDETECTORML_BACKEND")) {
+    cfg.backend = backend;
+  }
+  if (!std::filesystem::exists(cfg.modelPath)) {
+    WARN(fmt::format("Model {} not found, skipping benchmark", cfg.modelPath));
+    return;
+  }
+
+  constexpr std::size_t n_events = 1000;
+  constexpr std::size_t n_tracks = 50;
+
+  // Synthetic tagger tracks at the projection plane
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<float> pos(-50., 50.);
+  std::uniform_real_distribution<float> theta(M_PI - 0.03, M_PI - 0.002);
+  std::uniform_real_distribution<float> phi(-M_PI, M_PI);
+
+  auto tracks = std::make_unique<edm4eic::TrackParametersCollection>();
+  for (std::size_t i = 0; i < n_tracks; i++) {
+    tracks->create(0, 0, edm4hep::Vector2f(pos(rng), pos(rng)), theta(rng), phi(rng), 0., 0., 11, edm4eic::Cov6f());
+  }
+  auto beam_electrons = std::make_unique<edm4hep::MCParticleCollection>();
+  beam_electrons->create().setMomentum({0., 0., -10.});
+
+  auto run = [&](std::size_t batch_size) {
+    FarDetectorMLReconstruction algo("FarDetectorMLReconstruction");
+    algo.level(algorithms::LogLevel(spdlog::level::warn));
+    cfg.batchSize = batch_size;
+    algo.applyConfig(cfg);
+    algo.init();
+
+    std::vector<float> momenta;
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t event = 0; event < n_events; event++) {
+      auto trajectories = std::make_unique<edm4eic::TrajectoryCollection>();
+      auto parameters   = std::make_unique<edm4eic::TrackParametersCollection>();
+      auto out_tracks   = std::make_unique<edm4eic::TrackCollection>();
+      algo.process({tracks.get(), beam_electrons.get()}, {trajectories.get(), parameters.get(), out_tracks.get()});
+      if (event == 0) {
+        for (const auto& track : *out_tracks) {
+          momenta.push_back(track.getMomentum().x);
+          momenta.push_back(track.getMomentum().y);
+          momenta.push_back(track.getMomentum().z);
+        }
+      }
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    fmt::print("{} backend, batch size {}: {:.0f} tracks/s\n", cfg.backend,
+               batch_size == 0 ? n_tracks : batch_size, n_events * n_tracks / elapsed.count());
+    return momenta;
+  };
+
+  auto single  = run(1);
+  auto batched = run(0);
+
+  REQUIRE( single.size() == n_tracks * 3 );
+  REQUIRE( single == batched );
+}
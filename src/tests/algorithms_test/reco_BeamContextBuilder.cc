@@ -0,0 +1,144 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2024 EICrecon Authors
+
+#include <Math/Vector4D.h>
+#include <algorithms/interfaces/ParticleSvc.h>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <edm4eic/MCRecoParticleAssociationCollection.h>
+#include <edm4eic/ReconstructedParticleCollection.h>
+#include <edm4hep/MCParticleCollection.h>
+#include <cmath>
+
+#include "algorithms/reco/Beam.h"
+#include "algorithms/reco/BeamContext.h"
+#include "algorithms/reco/BeamContextBuilder.h"
+#include "algorithms/reco/Boost.h"
+
+using eicrecon::BeamContext;
+using eicrecon::BeamContextBuilder;
+using ROOT::Math::PxPyPzEVector;
+
+constexpr double EPSILON = 1e-6;
+
+namespace {
+
+  void require_equal(const PxPyPzEVector& a, const PxPyPzEVector& b) {
+    REQUIRE_THAT(a.Px(), Catch::Matchers::WithinAbs(b.Px(), EPSILON));
+    REQUIRE_THAT(a.Py(), Catch::Matchers::WithinAbs(b.Py(), EPSILON));
+    REQUIRE_THAT(a.Pz(), Catch::Matchers::WithinAbs(b.Pz(), EPSILON));
+    REQUIRE_THAT(a.E(), Catch::Matchers::WithinAbs(b.E(), EPSILON));
+  }
+
+}
+
+TEST_CASE( "the beam context matches the beam and boost helpers", "[BeamContextBuilder]" ) {
+  BeamContextBuilder algo("BeamContextBuilder");
+  algo.init();
+
+  const auto& particleSvc = algorithms::ParticleSvc::instance();
+
+  edm4hep::MCParticleCollection mcparts;
+  // a final-state photon before the beams, which must not be picked up
+  auto photon = mcparts.create();
+  photon.setGeneratorStatus(1);
+  photon.setPDG(22);
+  photon.setMomentum({1.f, 0.f, -3.f});
+  auto beam_electron = mcparts.create();
+  beam_electron.setGeneratorStatus(4);
+  beam_electron.setPDG(11);
+  beam_electron.setMomentum({0.f, 0.f, -17.9f});
+  auto beam_proton = mcparts.create();
+  beam_proton.setGeneratorStatus(4);
+  beam_proton.setPDG(2212);
+  beam_proton.setMomentum({-6.9f, 0.f, 274.9f});
+  auto scattered_electron = mcparts.create();
+  scattered_electron.setGeneratorStatus(1);
+  scattered_electron.setPDG(11);
+  scattered_electron.setMomentum({2.f, 1.f, -12.f});
+  // only the first final-state electron is the scattered one
+  auto other_electron = mcparts.create();
+  other_electron.setGeneratorStatus(1);
+  other_electron.setPDG(11);
+  other_electron.setMomentum({-1.f, 0.f, 5.f});
+
+  edm4eic::ReconstructedParticleCollection rcparts;
+  auto rc_other = rcparts.create();
+  auto rc_scattered = rcparts.create();
+  edm4eic::MCRecoParticleAssociationCollection assocs;
+  auto assoc_other = assocs.create();
+  assoc_other.setSim(other_electron);
+  assoc_other.setRec(rc_other);
+  auto assoc_scattered = assocs.create();
+  assoc_scattered.setSim(scattered_electron);
+  assoc_scattered.setRec(rc_scattered);
+
+  BeamContext context;
+  algo.process({&mcparts, &assocs}, {&context});
+
+  // the per-algorithm helpers the beam context replaces
+  const auto ei_coll = eicrecon::find_first_beam_electron(&mcparts);
+  const auto pi_coll = eicrecon::find_first_beam_hadron(&mcparts);
+  const auto ef_coll = eicrecon::find_first_scattered_electron(&mcparts);
+  REQUIRE( ei_coll.size() == 1 );
+  REQUIRE( pi_coll.size() == 1 );
+  REQUIRE( ef_coll.size() == 1 );
+
+  const auto ei = eicrecon::round_beam_four_momentum(
+    ei_coll[0].getMomentum(),
+    particleSvc.particle(ei_coll[0].getPDG()).mass,
+    {-5.0, -10.0, -18.0},
+    0.0);
+  const auto pi = eicrecon::round_beam_four_momentum(
+    pi_coll[0].getMomentum(),
+    particleSvc.particle(pi_coll[0].getPDG()).mass,
+    {41.0, 100.0, 275.0},
+    -0.025);
+  const auto boost = eicrecon::determine_boost(ei, pi);
+
+  REQUIRE( context.hasBeams() );
+
+  SECTION( "beams" ) {
+    REQUIRE( *context.mc_beam_electron == ei_coll[0] );
+    REQUIRE( *context.mc_beam_hadron == pi_coll[0] );
+    require_equal(context.ei, ei);
+    require_equal(context.pi, pi);
+  }
+
+  SECTION( "boost" ) {
+    require_equal(context.boost * ei, boost * ei);
+    require_equal(context.boost * pi, boost * pi);
+    // the hadron beam ends up along +z
+    const PxPyPzEVector pi_boosted = context.boost * context.pi;
+    REQUIRE_THAT(pi_boosted.Px(), Catch::Matchers::WithinAbs(0., 1e-3));
+    REQUIRE_THAT(pi_boosted.Py(), Catch::Matchers::WithinAbs(0., 1e-3));
+  }
+
+  SECTION( "scattered electron" ) {
+    REQUIRE( context.mc_scattered_electron.has_value() );
+    REQUIRE( *context.mc_scattered_electron == ef_coll[0] );
+    REQUIRE( context.rc_scattered_electron.has_value() );
+    REQUIRE( *context.rc_scattered_electron == rc_scattered );
+  }
+}
+
+TEST_CASE( "the beam context is empty without beams", "[BeamContextBuilder]" ) {
+  BeamContextBuilder algo("BeamContextBuilder");
+  algo.init();
+
+  edm4hep::MCParticleCollection mcparts;
+  auto electron = mcparts.create();
+  electron.setGeneratorStatus(1);
+  electron.setPDG(11);
+
+  BeamContext context;
+  algo.process({&mcparts, nullptr}, {&context});
+
+  REQUIRE( !context.hasBeams() );
+  REQUIRE( eicrecon::find_first_beam_electron(&mcparts).empty() );
+  REQUIRE( context.mc_scattered_electron.has_value() );
+  REQUIRE( *context.mc_scattered_electron == eicrecon::find_first_scattered_electron(&mcparts)[0] );
+  // without associations there is no reconstructed match
+  REQUIRE( !context.rc_scattered_electron.has_value() );
+}
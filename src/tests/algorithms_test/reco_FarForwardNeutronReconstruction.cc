@@ -3,6 +3,7 @@
 
 #include <Evaluator/DD4hepUnits.h>                 // for MeV, mm, keV, ns
 #include <catch2/catch_test_macros.hpp>            // for AssertionHandler, operator""_catch_sr, StringRef, REQUIRE, operator<, operator==, operator>, TEST_CASE
+#include <edm4eic/CalorimeterHitCollection.h>
 #include <edm4eic/ClusterCollection.h>
 #include <edm4eic/ReconstructedParticleCollection.h>
 #include <edm4hep/Vector3f.h>                      // for Vector3f
@@ -17,9 +18,11 @@
 #include <memory>                                  // for allocator, unique_ptr, make_unique, shared_ptr, __shared_ptr_access
 #include <vector>
 
+#include "algorithms/reco/FarForwardNeutronFastReconstruction.h"
 #include "algorithms/reco/FarForwardNeutronReconstruction.h"
 #include "algorithms/reco/FarForwardNeutronReconstructionConfig.h"
 
+using eicrecon::FarForwardNeutronFastReconstruction;
 using eicrecon::FarForwardNeutronReconstruction;
 using eicrecon::FarForwardNeutronReconstructionConfig;
 
@@ -73,3 +76,90 @@ TEST_CASE( "the cluster merging algorithm runs", "[FarForwardNeutronReconstructi
   REQUIRE( abs((*neutroncand_coll)[0].getMomentum().z-Pz_expected)/Pz_expected<tol);
 
 }
+
+TEST_CASE( "the hit-level fast path runs", "[FarForwardNeutronFastReconstruction]" ) {
+  FarForwardNeutronFastReconstruction algo("FarForwardNeutronFastReconstruction");
+
+  FarForwardNeutronReconstructionConfig cfg;
+  std::vector<double> corr_parameters={-0.0756, -1.91,  2.30};
+  cfg.scale_corr_coeff_hcal=corr_parameters;
+  cfg.scale_corr_coeff_ecal=corr_parameters;
+  cfg.hcal_sampling_fraction=0.5;
+  algo.applyConfig(cfg);
+  algo.init();
+
+  // Hcal rec hits are not corrected for the sampling fraction
+  edm4eic::CalorimeterHitCollection hits_hcal;
+  std::array<float,3> x={30*dd4hep::mm,90*dd4hep::mm,0};
+  std::array<float,3> y={-30*dd4hep::mm,0*dd4hep::mm, -90*dd4hep::mm};
+  std::array<float,3> z={30*dd4hep::m,30*dd4hep::m, 30*dd4hep::m};
+  std::array<double,3> E={80*dd4hep::GeV,5*dd4hep::GeV,5*dd4hep::GeV};
+  for(size_t i=0; i<3; i++){
+    auto hit=hits_hcal.create();
+    hit.setEnergy(E[i]*cfg.hcal_sampling_fraction);
+    hit.setPosition({x[i], y[i], z[i]});
+  }
+
+  edm4eic::CalorimeterHitCollection hits_ecal;
+  auto ecal_hit=hits_ecal.create();
+  ecal_hit.setEnergy(2);
+  ecal_hit.setPosition({0, 0, 25*dd4hep::m});
+
+  SECTION( "without reference" ) {
+    auto neutroncand_coll = std::make_unique<edm4eic::ReconstructedParticleCollection>();
+    auto cluster_coll = std::make_unique<edm4eic::ClusterCollection>();
+    algo.process({&hits_hcal, &hits_ecal, nullptr}, {neutroncand_coll.get(), cluster_coll.get()});
+
+    REQUIRE( (*neutroncand_coll).size() == 1);
+
+    // one cluster per calorimeter, holding the summed hits
+    REQUIRE( (*cluster_coll).size() == 2);
+    REQUIRE( (*neutroncand_coll)[0].clusters_size() == 2);
+    REQUIRE( (*neutroncand_coll)[0].getClusters(0).hits_size() == 3);
+    REQUIRE( abs((*neutroncand_coll)[0].getClusters(0).getEnergy()-90*dd4hep::GeV)/(90*dd4hep::GeV)<0.001);
+    REQUIRE( (*neutroncand_coll)[0].getClusters(1).hits_size() == 1);
+
+    // same energy as the cluster-based algorithm, direction along the energy-weighted centroid
+    double corr=FarForwardNeutronReconstruction::calc_corr(92, corr_parameters);
+    double tol=0.001;
+    double E_expected=92*dd4hep::GeV*1/(1+corr);
+    double x_expected=(80*30+5*90)*dd4hep::mm/90;
+    double y_expected=(-80*30-5*90)*dd4hep::mm/90;
+    const auto& p=(*neutroncand_coll)[0].getMomentum();
+    REQUIRE( abs((*neutroncand_coll)[0].getEnergy()-E_expected)/E_expected<tol);
+    REQUIRE( abs(p.x/p.z-x_expected/z[0])/(x_expected/z[0])<tol);
+    REQUIRE( abs(p.y/p.z-y_expected/z[0])/abs(y_expected/z[0])<tol);
+  }
+
+  SECTION( "without Ecal" ) {
+    auto neutroncand_coll = std::make_unique<edm4eic::ReconstructedParticleCollection>();
+    auto cluster_coll = std::make_unique<edm4eic::ClusterCollection>();
+    algo.process({&hits_hcal, nullptr, nullptr}, {neutroncand_coll.get(), cluster_coll.get()});
+
+    REQUIRE( (*neutroncand_coll).size() == 1);
+    REQUIRE( (*neutroncand_coll)[0].clusters_size() == 1);
+
+    double corr=FarForwardNeutronReconstruction::calc_corr(90, corr_parameters);
+    double E_expected=90*dd4hep::GeV*1/(1+corr);
+    REQUIRE( abs((*neutroncand_coll)[0].getEnergy()-E_expected)/E_expected<0.001);
+  }
+
+  SECTION( "with reference" ) {
+    // an unrelated candidate first, so matching by index would pick the wrong one
+    edm4eic::ReconstructedParticleCollection reference;
+    auto other=reference.create();
+    other.setEnergy(10);
+    other.setMomentum({10, 0, 0});
+    auto ref=reference.create();
+    ref.setEnergy(90);
+    ref.setMomentum({0, 0, 90});
+
+    auto neutroncand_coll = std::make_unique<edm4eic::ReconstructedParticleCollection>();
+    auto cluster_coll = std::make_unique<edm4eic::ClusterCollection>();
+    algo.process({&hits_hcal, &hits_ecal, &reference}, {neutroncand_coll.get(), cluster_coll.get()});
+
+    // validation does not change the output
+    REQUIRE( (*neutroncand_coll).size() == 1);
+  }
+
+}
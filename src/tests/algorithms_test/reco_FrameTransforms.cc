@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2024 EICrecon Authors
+
+#include <Math/LorentzRotation.h>
+#include <Math/Vector4D.h>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <edm4eic/InclusiveKinematicsCollection.h>
+#include <edm4eic/ReconstructedParticleCollection.h>
+#include <edm4hep/MCParticleCollection.h>
+#include <cmath>
+#include <memory>
+
+#include "algorithms/reco/BeamContext.h"
+#include "algorithms/reco/Boost.h"
+#include "algorithms/reco/FrameTransforms.h"
+#include "algorithms/reco/FrameTransformsBuilder.h"
+
+using eicrecon::BeamContext;
+using eicrecon::FourMomenta;
+using eicrecon::FrameTransforms;
+using eicrecon::FrameTransformsBuilder;
+using ROOT::Math::PxPyPzEVector;
+
+constexpr double EPSILON = 1e-3;
+
+TEST_CASE( "the frame transforms are built per event", "[FrameTransformsBuilder]" ) {
+  FrameTransformsBuilder algo("FrameTransformsBuilder");
+  algo.init();
+
+  const double m_p = 0.938272;
+  const PxPyPzEVector ei(0., 0., -18., 18.);
+  const PxPyPzEVector pi(0., 0., 275., std::hypot(275., m_p));
+  const PxPyPzEVector ef(5., 0., -10., std::hypot(5., 10.));
+  const PxPyPzEVector q = ei - ef;
+  const double Q2 = -q.M2();
+  const double x = Q2 / (2. * pi.Dot(q));
+
+  edm4hep::MCParticleCollection mcparts;
+  BeamContext context;
+  context.mc_beam_electron = mcparts.create();
+  context.mc_beam_hadron = mcparts.create();
+  context.ei = ei;
+  context.pi = pi;
+  context.boost = eicrecon::determine_boost(ei, pi);
+
+  edm4eic::ReconstructedParticleCollection rcparts;
+  auto scat = rcparts.create();
+  scat.setMomentum({static_cast<float>(ef.Px()), static_cast<float>(ef.Py()), static_cast<float>(ef.Pz())});
+  scat.setEnergy(ef.E());
+
+  edm4eic::InclusiveKinematicsCollection kine;
+  auto k = kine.create();
+  k.setX(x);
+  k.setQ2(Q2);
+  k.setScat(scat);
+
+  FrameTransforms transforms;
+  algo.process({&context, &kine}, {&transforms});
+
+  REQUIRE( transforms.has_breit );
+
+  SECTION( "virtual photon is purely space-like along -z in the Breit frame" ) {
+    const PxPyPzEVector q_breit = transforms.breit * q;
+    REQUIRE_THAT(q_breit.E(), Catch::Matchers::WithinAbs(0., EPSILON));
+    REQUIRE_THAT(q_breit.Px(), Catch::Matchers::WithinAbs(0., EPSILON));
+    REQUIRE_THAT(q_breit.Py(), Catch::Matchers::WithinAbs(0., EPSILON));
+    REQUIRE_THAT(q_breit.Pz(), Catch::Matchers::WithinAbs(-std::sqrt(Q2), EPSILON));
+  }
+
+  SECTION( "bulk transform agrees with the Lorentz rotation" ) {
+    FourMomenta p4;
+    p4.assign(rcparts);
+    eicrecon::apply_transform(transforms.breit, p4);
+    const PxPyPzEVector expected = transforms.breit * PxPyPzEVector(
+      scat.getMomentum().x, scat.getMomentum().y, scat.getMomentum().z, scat.getEnergy());
+    REQUIRE_THAT(p4.px[0], Catch::Matchers::WithinAbs(expected.Px(), EPSILON));
+    REQUIRE_THAT(p4.py[0], Catch::Matchers::WithinAbs(expected.Py(), EPSILON));
+    REQUIRE_THAT(p4.pz[0], Catch::Matchers::WithinAbs(expected.Pz(), EPSILON));
+    REQUIRE_THAT(p4.e[0], Catch::Matchers::WithinAbs(expected.E(), EPSILON));
+  }
+}
@@ -0,0 +1,133 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+// Copyright (C) 2024 EICrecon Authors
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <edm4hep/CaloHitContributionCollection.h>
+#include <edm4hep/EventHeaderCollection.h>
+#include <edm4hep/MCParticleCollection.h>
+#include <edm4hep/SimCalorimeterHitCollection.h>
+#include <edm4hep/SimTrackerHitCollection.h>
+#include <podio/Frame.h>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "services/io/podio/BackgroundMixer.h"
+
+using Catch::Matchers::WithinAbs;
+
+namespace {
+
+    /// A frame with a parent and a daughter particle, a tracker hit of the
+    /// daughter and a calorimeter hit with a contribution of the parent. If
+    /// with_foreign is set, both hits also relate to a particle of another
+    /// collection, which the mixer cannot remap.
+    podio::Frame make_frame(double time, bool with_foreign) {
+        podio::Frame frame;
+
+        edm4hep::EventHeaderCollection headers;
+        headers.create().setEventNumber(42);
+        frame.put(std::move(headers), "EventHeader");
+
+        edm4hep::MCParticleCollection particles;
+        auto parent = particles.create();
+        parent.setPDG(11);
+        parent.setTime(time);
+        auto daughter = particles.create();
+        daughter.setPDG(22);
+        daughter.setTime(time);
+        parent.addToDaughters(daughter);
+        daughter.addToParents(parent);
+
+        edm4hep::MCParticleCollection foreign_particles;
+        auto foreign = foreign_particles.create();
+
+        edm4hep::SimTrackerHitCollection tracker_hits;
+        auto tracker_hit = tracker_hits.create();
+        tracker_hit.setTime(time);
+        tracker_hit.setMCParticle(daughter);
+        if (with_foreign) {
+            tracker_hits.create().setMCParticle(foreign);
+        }
+
+        edm4hep::CaloHitContributionCollection contributions;
+        edm4hep::SimCalorimeterHitCollection calo_hits;
+        auto calo_hit = calo_hits.create();
+        auto contribution = contributions.create();
+        contribution.setTime(time);
+        contribution.setParticle(parent);
+        calo_hit.addToContributions(contribution);
+        if (with_foreign) {
+            auto foreign_contribution = contributions.create();
+            foreign_contribution.setParticle(foreign);
+            calo_hit.addToContributions(foreign_contribution);
+        }
+
+        frame.put(std::move(particles), "MCParticles");
+        frame.put(std::move(foreign_particles), "OtherParticles");
+        frame.put(std::move(tracker_hits), "TrackerHits");
+        frame.put(std::move(calo_hits), "EcalHits");
+        frame.put(std::move(contributions), "EcalHitsContributions");
+        return frame;
+    }
+
+}
+
+TEST_CASE("BackgroundMixer merges background frames into the signal frame", "[BackgroundMixer]") {
+    // Without sources no files are opened
+    BackgroundMixer mixer({}, 1);
+
+    auto signal = make_frame(0., false);
+    auto background = make_frame(1., true);
+    auto mixed = mixer.Mix(signal, {{&background, 100.}});
+
+    REQUIRE(mixer.GetBackgroundEventsMixed() == 1);
+    REQUIRE(mixed->get<edm4hep::EventHeaderCollection>("EventHeader")[0].getEventNumber() == 42);
+    REQUIRE(mixer.GetDroppedCollections().count("OtherParticles") == 1);
+
+    const auto& particles = mixed->get<edm4hep::MCParticleCollection>("MCParticles");
+    const auto particles_id = particles.getID();
+
+    SECTION("background particles follow the signal ones, shifted in time") {
+        REQUIRE(particles.size() == 4);
+        REQUIRE_THAT(particles[0].getTime(), WithinAbs(0., 1e-6));
+        REQUIRE_THAT(particles[2].getTime(), WithinAbs(101., 1e-6));
+        REQUIRE(particles[2].getPDG() == 11);
+        REQUIRE(particles[3].getPDG() == 22);
+    }
+
+    SECTION("parents and daughters are rebuilt within the merged collection") {
+        for (std::size_t offset : {0, 2}) {
+            REQUIRE(particles[offset].daughters_size() == 1);
+            REQUIRE(particles[offset].getDaughters(0).getObjectID().collectionID == particles_id);
+            REQUIRE(particles[offset].getDaughters(0).getObjectID().index == static_cast<int>(offset + 1));
+            REQUIRE(particles[offset + 1].parents_size() == 1);
+            REQUIRE(particles[offset + 1].getParents(0).getObjectID().index == static_cast<int>(offset));
+        }
+    }
+
+    SECTION("hit relations are remapped by the particle offset of their frame") {
+        const auto& tracker_hits = mixed->get<edm4hep::SimTrackerHitCollection>("TrackerHits");
+        REQUIRE(tracker_hits.size() == 2);
+        REQUIRE(tracker_hits[0].getMCParticle().getObjectID().collectionID == particles_id);
+        REQUIRE(tracker_hits[0].getMCParticle().getObjectID().index == 1);
+        REQUIRE(tracker_hits[1].getMCParticle().getObjectID().index == 3);
+        REQUIRE_THAT(tracker_hits[1].getTime(), WithinAbs(101., 1e-6));
+
+        const auto& calo_hits = mixed->get<edm4hep::SimCalorimeterHitCollection>("EcalHits");
+        const auto& contributions = mixed->get<edm4hep::CaloHitContributionCollection>("EcalHitsContributions");
+        REQUIRE(calo_hits.size() == 2);
+        REQUIRE(contributions.size() == 2);
+        REQUIRE(calo_hits[0].getContributions(0).getParticle().getObjectID().index == 0);
+        REQUIRE(calo_hits[1].getContributions(0).getParticle().getObjectID().index == 2);
+        REQUIRE_THAT(calo_hits[1].getContributions(0).getTime(), WithinAbs(101., 1e-6));
+    }
+
+    SECTION("relations that cannot be remapped are dropped") {
+        // The foreign tracker hit, and the foreign contribution of the calorimeter hit
+        REQUIRE(mixer.GetUnmatchedHitsDropped() == 2);
+        const auto& calo_hits = mixed->get<edm4hep::SimCalorimeterHitCollection>("EcalHits");
+        REQUIRE(calo_hits[1].contributions_size() == 1);
+    }
+}
@@ -10,15 +10,19 @@
 #include <fmt/core.h>
 #include <spdlog/logger.h>
 #include <stdint.h>
+#include <atomic>
+#include <chrono>
 #include <iostream>
 #include <map>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
 #include "extensions/jana/JOmniFactory.h"
 #include "extensions/jana/JOmniFactoryGeneratorT.h"
+#include "extensions/jana/JOmniFactoryGraph.h"
 
 struct BasicTestAlgConfig {
     int bucket_count = 42;
@@ -419,3 +423,125 @@ TEST_CASE("VariadicPodioOutputTests") {
     REQUIRE(left_hits->size() == 2);
     REQUIRE(right_hits->size() == 1);
 }
+
+// Diamond: upstream -> (left, right) -> merge, with left and right reading the same upstream collection
+struct DiamondCopyAlg : public JOmniFactory<DiamondCopyAlg, BasicTestAlgConfig> {
+
+    PodioInput<edm4hep::SimCalorimeterHit> m_hits_in {this};
+    PodioOutput<edm4hep::SimCalorimeterHit> m_hits_out {this};
+
+    inline static std::atomic<int> s_process_count{0};
+
+    void Configure() {}
+    void ChangeRun(int64_t run_number) {}
+
+    // NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+    void Process(int64_t run_number, uint64_t event_number) {
+        s_process_count++;
+        m_hits_out() = std::make_unique<edm4hep::SimCalorimeterHitCollection>();
+        m_hits_out()->setSubsetCollection();
+        for (const auto& hit : *m_hits_in()) {
+            m_hits_out()->push_back(hit);
+        }
+    }
+};
+
+struct DiamondBranchAlg : public JOmniFactory<DiamondBranchAlg, BasicTestAlgConfig> {
+
+    PodioInput<edm4hep::SimCalorimeterHit> m_hits_in {this};
+    PodioOutput<edm4hep::SimCalorimeterHit> m_hits_out {this};
+
+    inline static std::atomic<int> s_process_count{0};
+    inline static std::atomic<int> s_started{0};
+    inline static std::atomic<int> s_overlaps{0};
+
+    void Configure() {}
+    void ChangeRun(int64_t run_number) {}
+
+    // NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+    void Process(int64_t run_number, uint64_t event_number) {
+        s_process_count++;
+        // Wait (bounded) for the other branch, which only arrives if both run concurrently
+        s_started++;
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        while (s_started < 2 && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        if (s_started >= 2) {
+            s_overlaps++;
+        }
+        m_hits_out() = std::make_unique<edm4hep::SimCalorimeterHitCollection>();
+        m_hits_out()->setSubsetCollection();
+        for (const auto& hit : *m_hits_in()) {
+            m_hits_out()->push_back(hit);
+        }
+    }
+};
+
+struct DiamondMergeAlg : public JOmniFactory<DiamondMergeAlg, BasicTestAlgConfig> {
+
+    PodioInput<edm4hep::SimCalorimeterHit> m_left_in {this};
+    PodioInput<edm4hep::SimCalorimeterHit> m_right_in {this};
+    PodioOutput<edm4hep::SimCalorimeterHit> m_hits_out {this};
+
+    inline static std::atomic<int> s_process_count{0};
+
+    void Configure() {}
+    void ChangeRun(int64_t run_number) {}
+
+    // NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+    void Process(int64_t run_number, uint64_t event_number) {
+        s_process_count++;
+        m_hits_out() = std::make_unique<edm4hep::SimCalorimeterHitCollection>();
+        m_hits_out()->setSubsetCollection();
+        for (const auto& hit : *m_left_in()) {
+            m_hits_out()->push_back(hit);
+        }
+        for (const auto& hit : *m_right_in()) {
+            m_hits_out()->push_back(hit);
+        }
+    }
+};
+
+TEST_CASE("JOmniFactoryGraph runs a diamond with a shared upstream concurrently") {
+    JApplication app;
+    app.AddPlugin("log");
+    auto graph = std::make_shared<JOmniFactoryGraph>();
+    app.ProvideService(graph);
+
+    app.Add(new JOmniFactoryGeneratorT<DiamondCopyAlg>("DiamondUpstream", {"all_hits"}, {"upstream_hits"}, &app));
+    app.Add(new JOmniFactoryGeneratorT<DiamondBranchAlg>("DiamondLeft", {"upstream_hits"}, {"left_hits"}, &app));
+    app.Add(new JOmniFactoryGeneratorT<DiamondBranchAlg>("DiamondRight", {"upstream_hits"}, {"right_hits"}, &app));
+    app.Add(new JOmniFactoryGeneratorT<DiamondMergeAlg>("DiamondMerge", {"left_hits", "right_hits"}, {"merged_hits"}, &app));
+    app.Initialize();
+    graph->SetThreadCount(4);
+
+    const int n_events = 10;
+    for (int i = 0; i < n_events; ++i) {
+        auto event = std::make_shared<JEvent>();
+        app.GetService<JComponentManager>()->configure_event(*event);
+
+        edm4hep::SimCalorimeterHitCollection all_hits;
+        all_hits.create();
+        all_hits.create();
+        all_hits.create();
+        event->InsertCollection<edm4hep::SimCalorimeterHit>(std::move(all_hits), "all_hits");
+
+        DiamondBranchAlg::s_started = 0;
+        auto plan = graph->MakePlan({"merged_hits"});
+        REQUIRE(plan->trigger.size() == 4);
+        graph->Execute(*event, *plan);
+
+        REQUIRE(DiamondCopyAlg::s_process_count == i + 1);
+        REQUIRE(DiamondBranchAlg::s_process_count == 2 * (i + 1));
+        REQUIRE(DiamondMergeAlg::s_process_count == i + 1);
+
+        // Already produced, so this must not run any factory again
+        auto merged = event->GetCollection<edm4hep::SimCalorimeterHit>("merged_hits");
+        REQUIRE(merged->size() == 6);
+        REQUIRE(DiamondMergeAlg::s_process_count == i + 1);
+    }
+
+    // Both branches were in their algorithm at the same time
+    REQUIRE(DiamondBranchAlg::s_overlaps == 2 * n_events);
+}
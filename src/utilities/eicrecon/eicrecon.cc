@@ -19,6 +19,9 @@ std::vector<std::string> EICRECON_DEFAULT_PLUGINS = {
         "algorithms_init",
         "evaluator",
         "pid_lut",
+#ifdef USE_ONNX
+        "onnx",
+#endif
         "richgeo",
         "rootfile",
         "beam",